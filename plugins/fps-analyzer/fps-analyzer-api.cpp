@@ -0,0 +1,157 @@
+#include "fps-analyzer-api.h"
+#include "fps-analyzer-core.h"
+#include "fps-analyzer-kernels.h"
+#include <mutex>
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+
+// Detection runs on the pushing thread without the lock; only the stats and
+// pending settings are shared with readers
+struct fa_analyzer {
+    struct fa_detector detector;
+    std::mutex lock;
+    struct fa_stats stats;
+    struct fa_settings pending;
+    bool settings_changed;
+    size_t detector_bytes; // fa_detector_memory() after the latest frame
+};
+
+static std::once_flag g_kernels_once;
+
+static void apply_settings(struct fa_detector *det, const struct fa_settings *settings)
+{
+    det->analyze_method = settings->analyze_method;
+    det->sensitivity = settings->sensitivity;
+    det->enable_tearing_detection = settings->enable_tearing_detection;
+    det->tearing_sensitivity = settings->tearing_sensitivity;
+    det->sample_rows = settings->sample_rows > 0 ? (uint32_t)settings->sample_rows : 1;
+    det->sample_jitter = settings->sample_jitter;
+    det->sample_column_step = settings->sample_column_step > 0 ? (uint32_t)settings->sample_column_step : 1;
+    det->analysis_threads = settings->analysis_threads > 1 ? (uint32_t)settings->analysis_threads : 1;
+}
+
+fa_analyzer_t *fa_create(const struct fa_settings *settings)
+{
+    std::call_once(g_kernels_once, fa_kernels_init);
+
+    fa_analyzer_t *fa = new (std::nothrow) fa_analyzer();
+    if (!fa)
+        return NULL;
+    struct fa_settings defaults = {ANALYZE_LAST_LINE, 0.1, true, 1.0, 32, false, 1, 1, FA_HISTORY_DEFAULT};
+    if (!settings)
+        settings = &defaults;
+    apply_settings(&fa->detector, settings);
+    fa_stats_set_history_length(&fa->stats, settings->history_length);
+    return fa;
+}
+
+void fa_destroy(fa_analyzer_t *fa)
+{
+    if (!fa)
+        return;
+    fa_detector_free(&fa->detector);
+    fa_stats_free(&fa->stats);
+    delete fa;
+}
+
+void fa_update(fa_analyzer_t *fa, const struct fa_settings *settings)
+{
+    std::lock_guard<std::mutex> guard(fa->lock);
+    fa->pending = *settings;
+    fa->settings_changed = true;
+}
+
+bool fa_push_frame(fa_analyzer_t *fa, fa_pixel_format_t format,
+                   const uint8_t *data, uint32_t stride,
+                   uint32_t width, uint32_t height, uint64_t timestamp_ns,
+                   struct fa_frame_result *result)
+{
+    {
+        std::lock_guard<std::mutex> guard(fa->lock);
+        if (fa->settings_changed) {
+            apply_settings(&fa->detector, &fa->pending);
+            fa_stats_set_history_length(&fa->stats, fa->pending.history_length);
+            fa->settings_changed = false;
+        }
+    }
+
+    struct fa_frame_result res;
+    if (!fa_detector_process(&fa->detector, format, data, stride, width, height, &res))
+        return false;
+
+    {
+        std::lock_guard<std::mutex> guard(fa->lock);
+        fa->detector_bytes = fa_detector_memory(&fa->detector);
+        uint64_t prev = fa->stats.last_unique_frame_time;
+        fa_stats_push(&fa->stats, &res, timestamp_ns);
+        res.frametime_ns = (res.unique && prev != 0) ? timestamp_ns - prev : 0;
+    }
+    if (result)
+        *result = res;
+    return true;
+}
+
+bool fa_push_luma(fa_analyzer_t *fa, const uint8_t *luma, uint32_t stride,
+                  uint32_t width, uint32_t height, uint64_t timestamp_ns)
+{
+    return fa_push_frame(fa, FA_FORMAT_Y8, luma, stride, width, height, timestamp_ns, NULL);
+}
+
+void fa_snapshot(fa_analyzer_t *fa, struct fa_snapshot *snapshot)
+{
+    std::lock_guard<std::mutex> guard(fa->lock);
+    snapshot->fps = fa_stats_fps(&fa->stats);
+    snapshot->frametime_ms = fa_stats_frametime_ms(&fa->stats);
+    snapshot->tearing_detected = fa->stats.tearing_detected;
+    snapshot->last_unique_ns = fa->stats.last_unique_frame_time;
+    snapshot->history_count = fa->stats.frametime_count;
+    snapshot->history_length = fa_stats_history_length(&fa->stats);
+}
+
+int fa_copy_history(fa_analyzer_t *fa, uint16_t *smoothed, uint32_t *raw_us,
+                    uint16_t *fps, uint8_t *tearing, uint8_t *pacing, int max_count)
+{
+    std::lock_guard<std::mutex> guard(fa->lock);
+    return fa_stats_copy_history(&fa->stats, smoothed, raw_us, fps, tearing, pacing, max_count);
+}
+
+void fa_clear_history(fa_analyzer_t *fa)
+{
+    std::lock_guard<std::mutex> guard(fa->lock);
+    fa_stats_clear_history(&fa->stats);
+}
+
+void fa_history_range(fa_analyzer_t *fa, struct fa_history_range *range)
+{
+    std::lock_guard<std::mutex> guard(fa->lock);
+    fa_stats_range(&fa->stats, range);
+}
+
+void fa_frametime_stats(fa_analyzer_t *fa, struct fa_frametime_stats *session,
+                        struct fa_frametime_stats *recent)
+{
+    std::lock_guard<std::mutex> guard(fa->lock);
+    if (session)
+        fa_ft_histogram_summary(&fa->stats.session, session);
+    if (recent)
+        fa_ft_histogram_summary(&fa->stats.recent, recent);
+}
+
+void fa_pacing_stats(fa_analyzer_t *fa, struct fa_pacing_stats *pacing)
+{
+    std::lock_guard<std::mutex> guard(fa->lock);
+    fa_pacing_summary(&fa->stats.pacing, pacing);
+}
+
+void fa_reset_session(fa_analyzer_t *fa)
+{
+    std::lock_guard<std::mutex> guard(fa->lock);
+    fa_stats_reset_session(&fa->stats);
+}
+
+size_t fa_memory_usage(fa_analyzer_t *fa)
+{
+    std::lock_guard<std::mutex> guard(fa->lock);
+    return sizeof(*fa) + fa->detector_bytes + fa_stats_memory(&fa->stats);
+}
@@ -0,0 +1,186 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// FPS Analyzer core, C API. No libobs dependency: link the
+// fps-analyzer-core static library to embed the analyzer in other tools.
+//
+// Threading: fa_push_* must be called from one thread at a time. The other
+// functions may be called from any thread while frames are being pushed.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// History of unique frames (fa_settings.history_length)
+#define FA_HISTORY_DEFAULT 960 // 16 s at 60 fps
+#define FA_HISTORY_MIN 120
+#define FA_HISTORY_MAX 14400   // 60 s at 240 fps
+// Fixed point of the smoothed frametimes fa_copy_history() returns
+#define FA_SMOOTHED_UNITS_PER_MS 32 // 31.25 us per unit, up to 2047 ms
+
+// Dodaj enum do wyboru metody analizy
+typedef enum {
+    ANALYZE_LAST_LINE = 0,
+    ANALYZE_DIFF = 1,
+    ANALYZE_TILED = 2,  // full frame in tiles, stops diffing once the threshold is reached
+    ANALYZE_SAMPLED = 3 // sample_rows rows spread over the frame
+} analyze_method_t;
+
+// Layout of the plane the analysis reads
+typedef enum {
+    FA_FORMAT_NONE = 0,
+    FA_FORMAT_Y8,   // 8-bit luma plane (Y plane of NV12, I420, I422, I444)
+    FA_FORMAT_YUY2,
+    FA_FORMAT_UYVY,
+    FA_FORMAT_BGRA,
+    FA_FORMAT_RGBA
+} fa_pixel_format_t;
+
+// Bytes per pixel of the analyzed plane, 0 for FA_FORMAT_NONE
+uint32_t fa_pixel_format_bpp(fa_pixel_format_t format);
+
+struct fa_settings {
+    analyze_method_t analyze_method;
+    double sensitivity;          // % of ROI bytes that must change
+    bool enable_tearing_detection;
+    double tearing_sensitivity;  // % of a line that must change
+    // ANALYZE_SAMPLED
+    int sample_rows;             // rows compared per frame
+    bool sample_jitter;          // one random row per stratum instead of evenly spaced
+    int sample_column_step;      // compare every n-th pixel of a sampled row (1 = all)
+    // ANALYZE_DIFF: threads comparing row bands of frames with at least
+    // FA_MT_MIN_PIXELS pixels (1 = on the pushing thread only)
+    int analysis_threads;
+    // Unique frames kept for graphs and the recent statistics,
+    // FA_HISTORY_MIN..FA_HISTORY_MAX (0 = FA_HISTORY_DEFAULT). Changing it
+    // drops the history.
+    int history_length;
+};
+
+// Outcome of one frame
+struct fa_frame_result {
+    bool have_ref;       // false for the first frame after a start/resize
+    bool unique;         // differs enough from the previous frame
+    double diff_percent; // % of ROI bytes that differ from the previous frame
+    bool tearing;
+    uint64_t frametime_ns; // unique frames: time since the previous one (0 for the first)
+    // ANALYZE_TILED only: tiles in the frame, tiles over the sensitivity
+    // threshold and tiles compared before the early exit. diff_percent is
+    // then only counted up to the threshold.
+    uint32_t tiles_total;
+    uint32_t tiles_changed;
+    uint32_t tiles_scanned;
+    // Luma bytes compared with the previous frame (ROI + tearing lines)
+    uint64_t bytes_scanned;
+};
+
+// Current statistics
+struct fa_snapshot {
+    double fps;             // average over the last second of capture time
+    double frametime_ms;    // average frametime over the same window
+    bool tearing_detected;  // result of the latest frame
+    uint64_t last_unique_ns; // capture time of the latest unique frame, 0 if none
+    int history_count;      // entries fa_copy_history() would return
+    int history_length;     // entries the history holds when full
+};
+
+// Distribution of the frametimes of unique frames. Percentiles come from a
+// log-bucketed histogram and are within 1/256 (about 0.4 %) of the exact
+// value from 128 us up; the lows are the matching percentile frametime as a
+// framerate.
+struct fa_frametime_stats {
+    uint64_t frames;    // frametimes counted, 0 = no data
+    double avg_ms;
+    double p50_ms;
+    double p90_ms;
+    double p95_ms;
+    double p99_ms;
+    double p999_ms;
+    double low_1_fps;   // 1 % low: 1000 / p99_ms
+    double low_01_fps;  // 0.1 % low: 1000 / p999_ms
+};
+
+// Frame pacing class of a unique frame, measured in output refreshes
+typedef enum {
+    FA_PACE_OK = 0,      // shown for as many refreshes as the cadence
+    FA_PACE_UNEVEN = 1,  // off the cadence, e.g. 1 or 3 refreshes at 30 fps on 60 Hz
+    FA_PACE_STUTTER = 2  // shown for twice the cadence or longer
+} fa_pace_t;
+
+// Frame pacing of the frametime stream. The refresh interval is estimated
+// from the timestamps of all pushed frames (repeated ones included), the
+// cadence is the average number of refreshes per unique frame over the last
+// 120 unique frames, rounded. A 30 fps game on a 60 Hz output alternating
+// 16.7 / 50 ms has the same average as a steady one but a low consistency.
+struct fa_pacing_stats {
+    double refresh_hz;     // 0 until known
+    int cadence_refreshes; // refreshes per frame at the cadence, 0 = unknown
+    double cadence_fps;    // refresh_hz / cadence_refreshes
+    double consistency;    // % of the last 120 unique frames on the cadence
+    uint64_t violations;   // session: frames off the cadence (uneven or stutter)
+    uint64_t stutters;     // session: stutter frames
+};
+
+// Extremes of the history (what fa_copy_history() returns) for graph
+// scaling and legends, kept up to date as frames arrive, plus the longest
+// raw frametime of the last few seconds. All 0 while the history is empty.
+struct fa_history_range {
+    int count;               // history entries
+    double frametime_min_ms; // smoothed frametime, as graphed
+    double frametime_max_ms;
+    double fps_min;
+    double fps_max;
+    double peak_ms;          // longest raw frametime in the last peak_window_s
+    double peak_window_s;
+};
+
+typedef struct fa_analyzer fa_analyzer_t;
+
+// Settings may be NULL (defaults: last line, 0.1 %, tearing on at 1.0 %,
+// 32 evenly spaced sampled rows, single-threaded, FA_HISTORY_DEFAULT frames)
+fa_analyzer_t *fa_create(const struct fa_settings *settings);
+void fa_destroy(fa_analyzer_t *fa);
+// Takes effect from the next pushed frame
+void fa_update(fa_analyzer_t *fa, const struct fa_settings *settings);
+
+// Analyze one frame captured at timestamp_ns (any monotonic clock, > 0).
+// data/stride describe the plane given by format. result may be NULL.
+// Returns false for FA_FORMAT_NONE.
+bool fa_push_frame(fa_analyzer_t *fa, fa_pixel_format_t format,
+                   const uint8_t *data, uint32_t stride,
+                   uint32_t width, uint32_t height, uint64_t timestamp_ns,
+                   struct fa_frame_result *result);
+// fa_push_frame() for an 8-bit luma plane
+bool fa_push_luma(fa_analyzer_t *fa, const uint8_t *luma, uint32_t stride,
+                  uint32_t width, uint32_t height, uint64_t timestamp_ns);
+
+void fa_snapshot(fa_analyzer_t *fa, struct fa_snapshot *snapshot);
+// Frametime history of unique frames, oldest first, in compact types:
+// smoothed frametime (FA_SMOOTHED_UNITS_PER_MS per ms), raw frametime (us),
+// FPS at that frame, tearing flags as a bitset (entry i is bit i & 7 of
+// byte i / 8, (max_count + 7) / 8 bytes) and pacing class (fa_pace_t). Any
+// array may be NULL. Returns the number of entries written (at most
+// max_count).
+int fa_copy_history(fa_analyzer_t *fa, uint16_t *smoothed, uint32_t *raw_us,
+                    uint16_t *fps, uint8_t *tearing, uint8_t *pacing, int max_count);
+// Forget the history (e.g. the source stalled); the frame clock is kept
+void fa_clear_history(fa_analyzer_t *fa);
+// O(1): the extremes are maintained incrementally, no history scan
+void fa_history_range(fa_analyzer_t *fa, struct fa_history_range *range);
+// session: every frametime since fa_create() or fa_reset_session(), except
+// the gap of a stall that cleared the history. recent: the frames of the
+// history (what fa_copy_history() returns). Either may be NULL.
+void fa_frametime_stats(fa_analyzer_t *fa, struct fa_frametime_stats *session,
+                        struct fa_frametime_stats *recent);
+void fa_pacing_stats(fa_analyzer_t *fa, struct fa_pacing_stats *pacing);
+// Start a new session for fa_frametime_stats() and fa_pacing_stats()
+void fa_reset_session(fa_analyzer_t *fa);
+// Bytes held by the analyzer: statistics plus the detector's frame buffers
+// (which grow with the analyzed frame size)
+size_t fa_memory_usage(fa_analyzer_t *fa);
+
+#ifdef __cplusplus
+}
+#endif
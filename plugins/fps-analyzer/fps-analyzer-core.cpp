@@ -0,0 +1,970 @@
+#include "fps-analyzer-core.h"
+#include "fps-analyzer-kernels.h"
+#include "fps-analyzer-pool.h"
+#include <bit>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+uint32_t fa_pixel_format_bpp(fa_pixel_format_t format)
+{
+    switch (format) {
+    case FA_FORMAT_Y8:
+        return 1;
+    case FA_FORMAT_YUY2:
+    case FA_FORMAT_UYVY:
+        return 2;
+    case FA_FORMAT_BGRA:
+    case FA_FORMAT_RGBA:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+// --- Utility functions ---
+
+// Resize the luma double buffer; the reference is invalid afterwards
+static void ensure_luma_frames(struct fa_detector *det, uint32_t width, uint32_t rows) {
+    if (det->luma_width == width && det->luma_rows == rows)
+        return;
+    size_t needed = (size_t)width * rows;
+    if (det->luma_frames_size < needed) {
+        for (int i = 0; i < 2; ++i) {
+            free(det->luma_frames[i]);
+            det->luma_frames[i] = (uint8_t *)calloc(1, needed);
+        }
+        det->luma_frames_size = needed;
+    }
+    det->luma_width = width;
+    det->luma_rows = rows;
+    det->luma_ref_valid = false;
+}
+
+// Resize the tile map for a width x rows luma ROI
+static void ensure_tile_map(struct fa_detector *det, uint32_t width, uint32_t rows) {
+    uint32_t cols = (width + FA_TILE_WIDTH - 1) / FA_TILE_WIDTH;
+    uint32_t trows = (rows + FA_TILE_HEIGHT - 1) / FA_TILE_HEIGHT;
+    if (det->tile_map && det->tile_cols == cols && det->tile_rows == trows)
+        return;
+    free(det->tile_map);
+    det->tile_map = (uint8_t *)calloc((size_t)cols * trows, 1);
+    det->tile_cols = cols;
+    det->tile_rows = trows;
+}
+
+uint32_t fa_sample_rows(uint32_t height, uint32_t count, bool jitter, uint32_t *ys)
+{
+    if (count > height)
+        count = height;
+    for (uint32_t k = 0; k < count; ++k) {
+        uint32_t lo = (uint32_t)((uint64_t)k * height / count);
+        uint32_t hi = (uint32_t)((uint64_t)(k + 1) * height / count);
+        uint32_t off = (hi - lo) / 2;
+        if (jitter) {
+            // Fixed per stratum: both frames of a comparison need the same rows
+            uint32_t x = (k + 1) * 0x9E3779B9u;
+            x ^= x >> 16;
+            x *= 0x85EBCA6Bu;
+            x ^= x >> 13;
+            off = x % (hi - lo);
+        }
+        ys[k] = lo + off;
+    }
+    return count;
+}
+
+// Row table for ANALYZE_SAMPLED; a new pattern or column step invalidates
+// the reference. Returns the number of sampled rows.
+static uint32_t ensure_sample_rows(struct fa_detector *det, uint32_t height) {
+    uint32_t count = det->sample_rows > 1 ? det->sample_rows : 1;
+    if (count > height)
+        count = height;
+    if (det->sample_ys && det->sample_height == height && det->sample_count == count &&
+        det->sample_ys_jitter == det->sample_jitter && det->sample_step == det->sample_column_step)
+        return count;
+    free(det->sample_ys);
+    det->sample_ys = (uint32_t *)malloc(count * sizeof(uint32_t));
+    det->sample_count = fa_sample_rows(height, count, det->sample_jitter, det->sample_ys);
+    det->sample_height = height;
+    det->sample_ys_jitter = det->sample_jitter;
+    det->sample_step = det->sample_column_step;
+    det->luma_ref_valid = false;
+    return count;
+}
+
+// Every step-th pixel of a row to luma (same formulas as the row kernels)
+static void gather_luma(fa_pixel_format_t format, const uint8_t *src, uint8_t *luma,
+                        uint32_t width, uint32_t step)
+{
+    uint32_t n = 0;
+    switch (format) {
+    case FA_FORMAT_Y8:
+        for (uint32_t x = 0; x < width; x += step)
+            luma[n++] = src[x];
+        break;
+    case FA_FORMAT_YUY2:
+    case FA_FORMAT_UYVY: {
+        const uint32_t first = format == FA_FORMAT_UYVY ? 1 : 0;
+        for (uint32_t x = 0; x < width; x += step)
+            luma[n++] = src[2 * x + first];
+        break;
+    }
+    case FA_FORMAT_BGRA:
+    case FA_FORMAT_RGBA: {
+        const uint32_t ri = format == FA_FORMAT_BGRA ? 2 : 0;
+        const uint32_t bi = 2 - ri;
+        for (uint32_t x = 0; x < width; x += step) {
+            const uint8_t *p = src + 4 * x;
+            luma[n++] = (uint8_t)(((66 * p[ri] + 129 * p[1] + 25 * p[bi] + 128) >> 8) + 16);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void fa_detector_free(struct fa_detector *det)
+{
+    for (int i = 0; i < 2; ++i) {
+        free(det->luma_frames[i]);
+        det->luma_frames[i] = NULL;
+    }
+    free(det->tile_map);
+    det->tile_map = NULL;
+    det->tile_cols = 0;
+    det->tile_rows = 0;
+    free(det->sample_ys);
+    det->sample_ys = NULL;
+    det->sample_count = 0;
+    det->sample_height = 0;
+    fa_thread_pool_destroy(det->pool);
+    det->pool = NULL;
+    det->luma_frames_size = 0;
+    det->luma_width = 0;
+    det->luma_rows = 0;
+    det->luma_ref_valid = false;
+}
+
+const uint8_t *fa_detector_tile_map(const struct fa_detector *det, uint32_t *cols, uint32_t *rows)
+{
+    *cols = det->tile_map ? det->tile_cols : 0;
+    *rows = det->tile_map ? det->tile_rows : 0;
+    return det->tile_map;
+}
+
+size_t fa_detector_memory(const struct fa_detector *det)
+{
+    return 2 * det->luma_frames_size +
+           (size_t)det->tile_cols * det->tile_rows +
+           (det->sample_ys ? det->sample_count * sizeof(uint32_t) : 0);
+}
+
+// --- Tearing detection ---
+
+// Core tearing detection — takes the diff counts of 3 luma lines (top, mid, bottom)
+// against the previous frame, each roi_width bytes wide
+bool fa_detect_tearing(struct fa_detector *det, const size_t line_diff[3], int roi_width) {
+    if (!det->enable_tearing_detection) return false;
+
+    // Porównaj 3 linie osobno z progiem czułości
+    double change_percent[3] = {0.0, 0.0, 0.0};
+    for (int i = 0; i < 3; ++i) {
+        change_percent[i] = (roi_width > 0) ? (100.0 * line_diff[i] / roi_width) : 0.0;
+    }
+
+    // Ulepszona logika wykrywania tearingu
+    bool significant_change[3] = {false, false, false};
+    for (int i = 0; i < 3; ++i) {
+        significant_change[i] = (change_percent[i] >= det->tearing_sensitivity);
+    }
+
+    // Wykryj tearing: jeśli nie wszystkie linie się zmieniły jednocześnie
+    bool all_changed = significant_change[0] && significant_change[1] && significant_change[2];
+    bool none_changed = !significant_change[0] && !significant_change[1] && !significant_change[2];
+    bool tearing = !(all_changed || none_changed);
+
+    // Dodaj do historii tearingu
+    det->tearing_history[det->tearing_history_pos] = tearing ? 1 : 0;
+    det->tearing_history_pos = (det->tearing_history_pos + 1) % 5;
+
+    // Sprawdź czy w ostatnich 5 klatkach było więcej niż 2 wykrycia tearingu
+    int recent_tears = 0;
+    for (int i = 0; i < 5; ++i) {
+        recent_tears += det->tearing_history[i];
+    }
+    return (recent_tears >= 2);
+}
+
+// --- Frame extraction ---
+
+typedef void (*luma_convert_fn)(const uint8_t *src, uint8_t *luma, uint32_t width);
+
+// Pool for the configured thread count, NULL when single-threaded
+static struct fa_thread_pool *ensure_pool(struct fa_detector *det)
+{
+    uint32_t threads = det->analysis_threads < FA_MT_MAX_THREADS ? det->analysis_threads : FA_MT_MAX_THREADS;
+    if (det->pool && (threads <= 1 || fa_thread_pool_threads(det->pool) != (int)threads - 1)) {
+        fa_thread_pool_destroy(det->pool);
+        det->pool = NULL;
+    }
+    if (!det->pool && threads > 1)
+        det->pool = fa_thread_pool_create((int)threads - 1);
+    return det->pool;
+}
+
+// One ANALYZE_DIFF frame split into row bands, two per thread so a band
+// that was scheduled late does not hold up the others
+struct band_job {
+    luma_convert_fn convert;
+    const uint8_t *data;
+    uint32_t linesize;
+    uint32_t width;
+    uint32_t height;
+    uint32_t band_rows;
+    uint8_t *cur;
+    const uint8_t *prev;
+    bool have_ref;
+    struct {
+        alignas(64) size_t diff; // one cache line per band
+    } bands[2 * FA_MT_MAX_THREADS];
+};
+
+static void diff_band(void *ctx, int band)
+{
+    struct band_job *job = (struct band_job *)ctx;
+    const uint32_t y0 = (uint32_t)band * job->band_rows;
+    const uint32_t y1 = (y0 + job->band_rows < job->height) ? y0 + job->band_rows : job->height;
+    const uint32_t width = job->width;
+    size_t diff = 0;
+    for (uint32_t y = y0; y < y1; ++y) {
+        const uint8_t *src = job->data + (size_t)y * job->linesize;
+        uint8_t *dst = job->cur + (size_t)y * width;
+        const uint8_t *ref = job->prev + (size_t)y * width;
+        if (!job->convert) {
+            if (job->have_ref)
+                diff += fa_kernels.count_diff_copy(src, ref, dst, width);
+            else
+                memcpy(dst, src, width);
+        } else {
+            job->convert(src, dst, width);
+            if (job->have_ref)
+                diff += fa_kernels.count_diff_bytes(dst, ref, width);
+        }
+    }
+    job->bands[band].diff = diff;
+}
+
+// ANALYZE_DIFF on the pool: same result as the single-threaded loop. The
+// tearing lines are compared again after the bands are joined.
+static size_t process_full_threaded(struct fa_thread_pool *pool,
+                                    luma_convert_fn convert, const uint8_t *data, uint32_t linesize,
+                                    uint32_t width, uint32_t height,
+                                    uint8_t *cur, const uint8_t *prev, bool have_ref,
+                                    size_t line_diff[3], struct fa_frame_result *result)
+{
+    struct band_job job;
+    job.convert = convert;
+    job.data = data;
+    job.linesize = linesize;
+    job.width = width;
+    job.height = height;
+    job.cur = cur;
+    job.prev = prev;
+    job.have_ref = have_ref;
+    const uint32_t bands = 2 * (uint32_t)(fa_thread_pool_threads(pool) + 1);
+    job.band_rows = (height + bands - 1) / bands;
+    fa_thread_pool_run(pool, (int)((height + job.band_rows - 1) / job.band_rows), diff_band, &job);
+
+    size_t diff = 0;
+    for (uint32_t b = 0; b * job.band_rows < height; ++b)
+        diff += job.bands[b].diff;
+    if (have_ref) {
+        const uint32_t line_ys[3] = {0, height / 2, height - 1};
+        for (int i = 0; i < 3; ++i)
+            line_diff[i] = fa_kernels.count_diff_bytes(cur + (size_t)line_ys[i] * width,
+                                                       prev + (size_t)line_ys[i] * width, width);
+        result->bytes_scanned = (uint64_t)width * height;
+    }
+    return diff;
+}
+
+// ANALYZE_TILED pass over the whole frame. Each band of FA_TILE_HEIGHT rows
+// is extracted into cur and compared tile by tile. Once roi_diff reaches
+// needed the frame is unique and the remaining tiles are only extracted
+// (they are the next reference) and marked FA_TILE_SKIPPED. The tearing
+// lines are always compared in full. Returns true once needed was reached.
+static bool process_tiled(struct fa_detector *det, luma_convert_fn convert,
+                          const uint8_t *data, uint32_t linesize,
+                          uint32_t width, uint32_t height,
+                          uint8_t *cur, const uint8_t *prev, bool have_ref, size_t needed,
+                          size_t *roi_diff, size_t line_diff[3], struct fa_frame_result *result)
+{
+    ensure_tile_map(det, width, height);
+    const uint32_t line_ys[3] = {0, height / 2, height - 1};
+    bool done = !have_ref || needed == 0;
+    size_t diff = 0;
+    uint32_t scanned = 0, changed = 0;
+
+    for (uint32_t band = 0; band < det->tile_rows; ++band) {
+        const uint32_t y0 = band * FA_TILE_HEIGHT;
+        const uint32_t y1 = (y0 + FA_TILE_HEIGHT < height) ? y0 + FA_TILE_HEIGHT : height;
+        uint8_t *map = det->tile_map + (size_t)band * det->tile_cols;
+
+        if (convert) {
+            for (uint32_t y = y0; y < y1; ++y)
+                convert(data + (size_t)y * linesize, cur + (size_t)y * width, width);
+        } else if (done) {
+            for (uint32_t y = y0; y < y1; ++y)
+                memcpy(cur + (size_t)y * width, data + (size_t)y * linesize, width);
+        }
+
+        for (uint32_t c = 0; c < det->tile_cols; ++c) {
+            const uint32_t x0 = c * FA_TILE_WIDTH;
+            const uint32_t w = (x0 + FA_TILE_WIDTH < width) ? FA_TILE_WIDTH : width - x0;
+            if (done) {
+                map[c] = FA_TILE_SKIPPED;
+                continue;
+            }
+            size_t d = 0;
+            for (uint32_t y = y0; y < y1; ++y) {
+                const size_t off = (size_t)y * width + x0;
+                if (convert)
+                    d += fa_kernels.count_diff_bytes(cur + off, prev + off, w);
+                else
+                    d += fa_kernels.count_diff_copy(data + (size_t)y * linesize + x0, prev + off, cur + off, w);
+            }
+            const size_t tile_bytes = (size_t)w * (y1 - y0);
+            result->bytes_scanned += tile_bytes;
+            const bool tile_changed = d > 0 && 100.0 * d >= det->sensitivity * tile_bytes;
+            map[c] = tile_changed ? FA_TILE_CHANGED : FA_TILE_UNCHANGED;
+            changed += tile_changed;
+            scanned++;
+            diff += d;
+            if (diff >= needed) {
+                done = true;
+                // Y8: copy the rest of this band that the compare did not
+                if (!convert && c + 1 < det->tile_cols) {
+                    const uint32_t xe = x0 + w;
+                    for (uint32_t y = y0; y < y1; ++y)
+                        memcpy(cur + (size_t)y * width + xe, data + (size_t)y * linesize + xe, width - xe);
+                }
+            }
+        }
+
+        for (int i = 0; i < 3; ++i) {
+            if (have_ref && line_ys[i] >= y0 && line_ys[i] < y1) {
+                line_diff[i] = fa_kernels.count_diff_bytes(cur + (size_t)line_ys[i] * width,
+                                                           prev + (size_t)line_ys[i] * width, width);
+                result->bytes_scanned += width;
+            }
+        }
+    }
+
+    *roi_diff = diff;
+    result->tiles_total = det->tile_cols * det->tile_rows;
+    result->tiles_changed = changed;
+    result->tiles_scanned = scanned;
+    return have_ref && diff >= needed;
+}
+
+// Single pass over the source rows: extract luma into the current half of the
+// double buffer and count differences against the previous half. Luma planes
+// are compared straight from the source (data/linesize), so there is no
+// separate copy. The tearing lines come out of the same pass.
+bool fa_detector_process(struct fa_detector *det, fa_pixel_format_t format,
+                         const uint8_t *data, uint32_t linesize,
+                         uint32_t width, uint32_t height,
+                         struct fa_frame_result *result)
+{
+    // Packed formats go through the BT.601 / 4:2:2 row converters
+    luma_convert_fn convert = NULL;
+    switch (format) {
+    case FA_FORMAT_Y8:
+        break;
+    case FA_FORMAT_YUY2:
+        convert = fa_kernels.yuy2_to_luma;
+        break;
+    case FA_FORMAT_UYVY:
+        convert = fa_kernels.uyvy_to_luma;
+        break;
+    case FA_FORMAT_BGRA:
+        convert = fa_kernels.bgra_to_luma;
+        break;
+    case FA_FORMAT_RGBA:
+        convert = fa_kernels.rgba_to_luma;
+        break;
+    default:
+        return false;
+    }
+    memset(result, 0, sizeof(*result));
+    if (width == 0 || height == 0)
+        return true;
+
+    // Rows kept in the luma buffer. Full frame: every row, the tearing lines
+    // are a subset. Last line: the tearing lines (if enabled) + the last row.
+    // Sampled: the sampled rows, then the tearing lines (if enabled).
+    const bool tiled = det->analyze_method == ANALYZE_TILED;
+    const bool full = tiled || det->analyze_method == ANALYZE_DIFF;
+    const bool sampled = det->analyze_method == ANALYZE_SAMPLED;
+    const bool tear = det->enable_tearing_detection;
+    const uint32_t line_ys[3] = {0, height / 2, height - 1};
+    const uint32_t samples = sampled ? ensure_sample_rows(det, height) : 0;
+    const uint32_t step = (sampled && det->sample_column_step > 1) ? det->sample_column_step : 1;
+    const uint32_t sample_width = (width + step - 1) / step;
+    uint32_t rows;
+    if (full)
+        rows = height;
+    else if (sampled)
+        rows = samples + (tear ? 3 : 0);
+    else
+        rows = tear ? 3 : 1;
+    const uint32_t roi_first = (full || sampled) ? 0 : rows - 1;
+    const uint32_t roi_end = sampled ? samples : rows;
+    uint32_t tear_rows[3] = {samples, samples + 1, samples + 2};
+    if (full) {
+        for (int i = 0; i < 3; ++i) tear_rows[i] = line_ys[i];
+    }
+
+    ensure_luma_frames(det, width, rows);
+    uint8_t *cur = det->luma_frames[det->luma_cur];
+    const uint8_t *prev = det->luma_frames[det->luma_cur ^ 1];
+    const bool have_ref = det->luma_ref_valid;
+
+    size_t roi_diff = 0;
+    size_t line_diff[3] = {0, 0, 0};
+    bool reached = false;
+    struct fa_thread_pool *pool = (det->analyze_method == ANALYZE_DIFF) ? ensure_pool(det) : NULL;
+    if (pool && (uint64_t)width * height >= FA_MT_MIN_PIXELS) {
+        roi_diff = process_full_threaded(pool, convert, data, linesize, width, height,
+                                         cur, prev, have_ref, line_diff, result);
+    } else if (tiled) {
+        const size_t needed = (size_t)ceil((double)width * height * det->sensitivity / 100.0);
+        reached = process_tiled(det, convert, data, linesize, width, height, cur, prev, have_ref,
+                                needed, &roi_diff, line_diff, result);
+    } else {
+        for (uint32_t r = 0; r < rows; ++r) {
+            uint32_t y = full ? r : r < samples ? det->sample_ys[r] : line_ys[3 - rows + r];
+            const uint8_t *src = data + (size_t)y * linesize;
+            uint8_t *dst = cur + (size_t)r * width;
+            const uint8_t *ref = prev + (size_t)r * width;
+            size_t d = 0;
+            if (r < samples && step > 1) {
+                gather_luma(format, src, dst, width, step);
+                if (have_ref)
+                    d = fa_kernels.count_diff_bytes(dst, ref, sample_width);
+            } else if (!convert) {
+                if (have_ref)
+                    d = fa_kernels.count_diff_copy(src, ref, dst, width);
+                else
+                    memcpy(dst, src, width);
+            } else {
+                convert(src, dst, width);
+                if (have_ref)
+                    d = fa_kernels.count_diff_bytes(dst, ref, width);
+            }
+            if (have_ref)
+                result->bytes_scanned += r < samples ? sample_width : width;
+            if (r >= roi_first && r < roi_end)
+                roi_diff += d;
+            for (int i = 0; i < 3; ++i) {
+                if (tear_rows[i] == r) line_diff[i] = d;
+            }
+        }
+    }
+
+    // Current frame becomes the reference — swap instead of copying
+    det->luma_cur ^= 1;
+    det->luma_ref_valid = true;
+
+    // Wykrywanie tearingu (niezależne od metody analizy)
+    result->have_ref = have_ref;
+    result->tearing = have_ref ? fa_detect_tearing(det, line_diff, (int)width) : false;
+
+    size_t roi_size = sampled ? (size_t)sample_width * samples : (size_t)width * (roi_end - roi_first);
+    result->diff_percent = (have_ref && roi_size > 0) ? (100.0 * roi_diff / roi_size) : 0.0;
+    result->unique = !have_ref || reached || result->diff_percent >= det->sensitivity;
+    result->frametime_ns = 0; // filled in by the stats
+    return true;
+}
+
+// --- Frametime histogram ---
+
+static inline uint32_t ft_bucket(uint64_t ns)
+{
+    uint64_t us = ns / 1000;
+    if (us >= (1ULL << FA_FT_HIST_MAX_BITS))
+        us = (1ULL << FA_FT_HIST_MAX_BITS) - 1;
+    if (us < (1ULL << FA_FT_HIST_SUB_BITS))
+        return (uint32_t)us;
+    // Position of the top bit selects the octave, the next SUB_BITS bits the
+    // bucket inside it; the first octave continues the exact range seamlessly
+    uint32_t top = (uint32_t)std::bit_width(us) - 1;
+    uint32_t shift = top - FA_FT_HIST_SUB_BITS;
+    return ((shift + 1) << FA_FT_HIST_SUB_BITS) +
+           (uint32_t)((us >> shift) & ((1u << FA_FT_HIST_SUB_BITS) - 1));
+}
+
+// Middle of the bucket's value range, in ms
+static double ft_bucket_ms(uint32_t bucket)
+{
+    const uint32_t sub_count = 1u << FA_FT_HIST_SUB_BITS;
+    if (bucket < sub_count)
+        return (bucket + 0.5) / 1000.0;
+    uint32_t shift = (bucket >> FA_FT_HIST_SUB_BITS) - 1;
+    double low = (double)((uint64_t)(sub_count + (bucket & (sub_count - 1))) << shift);
+    return (low + (double)(1ULL << shift) / 2.0) / 1000.0;
+}
+
+void fa_ft_histogram_add(struct fa_ft_histogram *hist, uint64_t ns)
+{
+    hist->buckets[ft_bucket(ns)]++;
+    hist->count++;
+    hist->sum_ns += ns;
+}
+
+void fa_ft_histogram_remove(struct fa_ft_histogram *hist, uint64_t ns)
+{
+    hist->buckets[ft_bucket(ns)]--;
+    hist->count--;
+    hist->sum_ns -= ns;
+}
+
+void fa_ft_histogram_clear(struct fa_ft_histogram *hist)
+{
+    memset(hist, 0, sizeof(*hist));
+}
+
+void fa_ft_histogram_summary(const struct fa_ft_histogram *hist, struct fa_frametime_stats *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (hist->count == 0)
+        return;
+    out->frames = hist->count;
+    out->avg_ms = hist->sum_ns / 1000000.0 / hist->count;
+
+    // Nearest-rank percentiles: the value of the ceil(q * n)-th smallest frametime
+    static const double quantiles[5] = {0.50, 0.90, 0.95, 0.99, 0.999};
+    double *values[5] = {&out->p50_ms, &out->p90_ms, &out->p95_ms, &out->p99_ms, &out->p999_ms};
+    uint64_t ranks[5];
+    for (int q = 0; q < 5; q++) {
+        ranks[q] = (uint64_t)ceil(quantiles[q] * hist->count);
+        if (ranks[q] < 1)
+            ranks[q] = 1;
+    }
+    uint64_t seen = 0;
+    int q = 0;
+    for (uint32_t b = 0; b < FA_FT_HIST_BUCKETS && q < 5; b++) {
+        seen += hist->buckets[b];
+        while (q < 5 && seen >= ranks[q])
+            *values[q++] = ft_bucket_ms(b);
+    }
+    out->low_1_fps = out->p99_ms > 0.0 ? 1000.0 / out->p99_ms : 0.0;
+    out->low_01_fps = out->p999_ms > 0.0 ? 1000.0 / out->p999_ms : 0.0;
+}
+
+// --- Frame pacing ---
+
+void fa_pacing_frame(struct fa_pacing *pacing, uint64_t timestamp)
+{
+    uint64_t last = pacing->last_frame_ns;
+    pacing->last_frame_ns = timestamp;
+    if (last == 0 || timestamp <= last)
+        return;
+
+    // Slow EMA of the frame interval. Intervals outside 2/3..3/2 of the
+    // estimate (dropped or late frames) are ignored, unless they keep coming:
+    // then the output rate changed
+    int64_t interval = (int64_t)(timestamp - last);
+    int64_t refresh = (int64_t)pacing->refresh_ns;
+    if (refresh == 0 || (interval * 2 < refresh * 3 && interval * 3 > refresh * 2)) {
+        pacing->refresh_ns = refresh == 0 ? (uint64_t)interval : (uint64_t)(refresh + (interval - refresh) / 16);
+        pacing->refresh_rejects = 0;
+    } else if (++pacing->refresh_rejects >= 8) {
+        pacing->refresh_ns = (uint64_t)interval;
+        pacing->refresh_rejects = 0;
+    }
+}
+
+static inline int pacing_cadence(const struct fa_pacing *pacing)
+{
+    if (pacing->window_count == 0)
+        return 0;
+    int cadence = (pacing->window_sum + pacing->window_count / 2) / pacing->window_count;
+    return cadence > 0 ? cadence : 1;
+}
+
+uint8_t fa_pacing_unique(struct fa_pacing *pacing, uint64_t frametime_ns)
+{
+    if (pacing->refresh_ns == 0)
+        return FA_PACE_OK;
+
+    uint64_t refreshes = (frametime_ns + pacing->refresh_ns / 2) / pacing->refresh_ns;
+    if (refreshes < 1)
+        refreshes = 1;
+    if (refreshes > FA_PACE_MAX_REFRESHES)
+        refreshes = FA_PACE_MAX_REFRESHES;
+
+    int pos = pacing->window_pos;
+    if (pacing->window_count == FA_PACE_WINDOW) {
+        pacing->window_sum -= pacing->window[pos];
+        pacing->window_counts[pacing->window[pos]]--;
+    } else {
+        pacing->window_count++;
+    }
+    pacing->window[pos] = (uint8_t)refreshes;
+    pacing->window_sum += (int)refreshes;
+    pacing->window_counts[refreshes]++;
+    pacing->window_pos = (pos + 1) % FA_PACE_WINDOW;
+
+    int cadence = pacing_cadence(pacing);
+    if ((int)refreshes == cadence)
+        return FA_PACE_OK;
+    pacing->violations++;
+    if ((int)refreshes >= 2 * cadence) {
+        pacing->stutters++;
+        return FA_PACE_STUTTER;
+    }
+    return FA_PACE_UNEVEN;
+}
+
+void fa_pacing_clear_window(struct fa_pacing *pacing)
+{
+    pacing->window_pos = 0;
+    pacing->window_count = 0;
+    pacing->window_sum = 0;
+    memset(pacing->window_counts, 0, sizeof(pacing->window_counts));
+}
+
+void fa_pacing_summary(const struct fa_pacing *pacing, struct fa_pacing_stats *out)
+{
+    memset(out, 0, sizeof(*out));
+    out->violations = pacing->violations;
+    out->stutters = pacing->stutters;
+    if (pacing->refresh_ns == 0)
+        return;
+    out->refresh_hz = 1e9 / (double)pacing->refresh_ns;
+    int cadence = pacing_cadence(pacing);
+    if (cadence == 0)
+        return;
+    out->cadence_refreshes = cadence;
+    out->cadence_fps = out->refresh_hz / cadence;
+    int on_cadence = cadence <= FA_PACE_MAX_REFRESHES ? pacing->window_counts[cadence] : 0;
+    out->consistency = 100.0 * on_cadence / pacing->window_count;
+}
+
+// --- Sliding extremes ---
+
+// values[slot] was just written: drop the entries it beats from the back
+// (largest: the maximum is kept, otherwise the minimum), then append it
+template <typename T>
+static void extremum_push(struct fa_extremum *ex, const T *values, int slot, bool largest, int size)
+{
+    const T v = values[slot];
+    while (ex->count > 0) {
+        T back = values[ex->slot[(ex->head + ex->count - 1) % size]];
+        if (largest ? back > v : back < v)
+            break;
+        ex->count--;
+    }
+    ex->slot[(ex->head + ex->count) % size] = (uint16_t)slot;
+    ex->count++;
+}
+
+// Slot about to be overwritten or aged out: leaves if it is the front
+static void extremum_evict(struct fa_extremum *ex, int slot, int size)
+{
+    if (ex->count > 0 && ex->slot[ex->head] == slot) {
+        ex->head = (ex->head + 1) % size;
+        ex->count--;
+    }
+}
+
+#define FA_EXTREMES 5
+
+static void extremes_get(struct fa_stats *stats, struct fa_extremum *ex[FA_EXTREMES])
+{
+    ex[0] = &stats->smoothed_min;
+    ex[1] = &stats->smoothed_max;
+    ex[2] = &stats->fps_min;
+    ex[3] = &stats->fps_max;
+    ex[4] = &stats->peak;
+}
+
+static void extremes_clear(struct fa_stats *stats)
+{
+    struct fa_extremum *ex[FA_EXTREMES];
+    extremes_get(stats, ex);
+    for (int i = 0; i < FA_EXTREMES; i++) {
+        ex[i]->head = 0;
+        ex[i]->count = 0;
+    }
+}
+
+static void extremes_evict(struct fa_stats *stats, int slot)
+{
+    struct fa_extremum *ex[FA_EXTREMES];
+    extremes_get(stats, ex);
+    for (int i = 0; i < FA_EXTREMES; i++)
+        extremum_evict(ex[i], slot, stats->history_size);
+}
+
+template <typename T>
+static inline double extremum_value(const struct fa_extremum *ex, const T *values, double scale)
+{
+    int slot = fa_extremum_front(ex);
+    return slot >= 0 ? values[slot] / scale : 0.0;
+}
+
+// --- Statistics ---
+
+int fa_stats_history_length(const struct fa_stats *stats)
+{
+    int n = stats->history_length > 0 ? stats->history_length : FA_HISTORY_DEFAULT;
+    return n < FA_HISTORY_MIN ? FA_HISTORY_MIN : (n > FA_HISTORY_MAX ? FA_HISTORY_MAX : n);
+}
+
+static void history_free(struct fa_stats *stats)
+{
+    free(stats->frametime_us);
+    free(stats->frame_end_us);
+    free(stats->smoothed);
+    free(stats->fps);
+    free(stats->pacing_class);
+    free(stats->tearing);
+    stats->frametime_us = stats->frame_end_us = NULL;
+    stats->smoothed = stats->fps = NULL;
+    stats->pacing_class = stats->tearing = NULL;
+    struct fa_extremum *ex[FA_EXTREMES];
+    extremes_get(stats, ex);
+    for (int i = 0; i < FA_EXTREMES; i++) {
+        free(ex[i]->slot);
+        ex[i]->slot = NULL;
+    }
+    stats->history_size = 0;
+}
+
+// Allocate the ring for the requested length; false if out of memory
+static bool ensure_history(struct fa_stats *stats)
+{
+    const int n = fa_stats_history_length(stats);
+    if (stats->history_size == n)
+        return true;
+    // Only the history is dropped: the next frametime is still a real one
+    bool gap = stats->session_gap;
+    history_free(stats);
+    fa_stats_clear_history(stats);
+    stats->session_gap = gap;
+    stats->frametime_us = (uint32_t *)calloc(n, sizeof(uint32_t));
+    stats->frame_end_us = (uint32_t *)calloc(n, sizeof(uint32_t));
+    stats->smoothed = (uint16_t *)calloc(n, sizeof(uint16_t));
+    stats->fps = (uint16_t *)calloc(n, sizeof(uint16_t));
+    stats->pacing_class = (uint8_t *)calloc(n, 1);
+    stats->tearing = (uint8_t *)calloc((n + 7) / 8, 1);
+    bool ok = stats->frametime_us && stats->frame_end_us && stats->smoothed && stats->fps &&
+              stats->pacing_class && stats->tearing;
+    struct fa_extremum *ex[FA_EXTREMES];
+    extremes_get(stats, ex);
+    for (int i = 0; i < FA_EXTREMES; i++) {
+        ex[i]->slot = (uint16_t *)calloc(n, sizeof(uint16_t));
+        ok = ok && ex[i]->slot;
+    }
+    if (!ok) {
+        history_free(stats);
+        return false;
+    }
+    stats->history_size = n;
+    return true;
+}
+
+void fa_stats_set_history_length(struct fa_stats *stats, int length)
+{
+    stats->history_length = length;
+}
+
+size_t fa_stats_memory(const struct fa_stats *stats)
+{
+    const size_t n = (size_t)stats->history_size;
+    return n * (2 * sizeof(uint32_t) + 2 * sizeof(uint16_t) + 1 + FA_EXTREMES * sizeof(uint16_t)) +
+           (n + 7) / 8;
+}
+
+void fa_stats_free(struct fa_stats *stats)
+{
+    history_free(stats);
+}
+
+double fa_stats_fps(const struct fa_stats *stats)
+{
+    if (stats->window_sum_us == 0)
+        return 0.0;
+    return stats->window_count * 1000000.0 / (double)stats->window_sum_us;
+}
+
+double fa_stats_frametime_ms(const struct fa_stats *stats)
+{
+    if (stats->window_count == 0)
+        return 0.0;
+    return stats->window_sum_us / 1000.0 / stats->window_count;
+}
+
+void fa_stats_clear_history(struct fa_stats *stats)
+{
+    stats->frametime_count = 0;
+    stats->frametime_pos = 0;
+    stats->window_count = 0;
+    stats->window_sum_us = 0;
+    fa_ft_histogram_clear(&stats->recent);
+    fa_pacing_clear_window(&stats->pacing);
+    extremes_clear(stats);
+    stats->session_gap = true;
+}
+
+void fa_stats_range(const struct fa_stats *stats, struct fa_history_range *out)
+{
+    out->count = stats->frametime_count;
+    out->frametime_min_ms = extremum_value(&stats->smoothed_min, stats->smoothed, FA_SMOOTHED_UNITS_PER_MS);
+    out->frametime_max_ms = extremum_value(&stats->smoothed_max, stats->smoothed, FA_SMOOTHED_UNITS_PER_MS);
+    out->fps_min = extremum_value(&stats->fps_min, stats->fps, 1.0);
+    out->fps_max = extremum_value(&stats->fps_max, stats->fps, 1.0);
+    out->peak_ms = extremum_value(&stats->peak, stats->frametime_us, 1000.0);
+    out->peak_window_s = FA_PEAK_WINDOW_NS / 1e9;
+}
+
+int fa_stats_copy_history(const struct fa_stats *stats, uint16_t *smoothed, uint32_t *raw_us,
+                          uint16_t *fps, uint8_t *tearing, uint8_t *pacing, int max_count)
+{
+    int count = stats->frametime_count;
+    if (count > max_count)
+        count = max_count;
+    if (tearing)
+        memset(tearing, 0, ((size_t)count + 7) / 8);
+    // Linearize the ring (oldest → newest): at most two contiguous runs
+    const int size = stats->history_size;
+    int src = (stats->frametime_pos - count + size) % size;
+    for (int i = 0; i < count;) {
+        int run = size - src < count - i ? size - src : count - i;
+        if (smoothed) memcpy(smoothed + i, stats->smoothed + src, run * sizeof(uint16_t));
+        if (raw_us) memcpy(raw_us + i, stats->frametime_us + src, run * sizeof(uint32_t));
+        if (fps) memcpy(fps + i, stats->fps + src, run * sizeof(uint16_t));
+        if (pacing) memcpy(pacing + i, stats->pacing_class + src, run);
+        if (tearing) {
+            for (int k = 0; k < run; k++)
+                if (fa_stats_tearing_at(stats, src + k))
+                    tearing[(i + k) >> 3] |= (uint8_t)(1u << ((i + k) & 7));
+        }
+        i += run;
+        src = 0;
+    }
+    return count;
+}
+
+void fa_stats_reset_session(struct fa_stats *stats)
+{
+    fa_ft_histogram_clear(&stats->session);
+    stats->pacing.violations = 0;
+    stats->pacing.stutters = 0;
+}
+
+static inline uint16_t saturate_u16(double v)
+{
+    return v >= 65535.0 ? 65535 : (uint16_t)(v + 0.5);
+}
+
+// Wspólna logika analizy klatek — rolling window, frametime
+bool fa_stats_push(struct fa_stats *stats, const struct fa_frame_result *result, uint64_t timestamp)
+{
+    stats->tearing_detected = result->tearing;
+    fa_pacing_frame(&stats->pacing, timestamp);
+    if (!ensure_history(stats))
+        return false;
+
+    const int size = stats->history_size;
+    const uint32_t now_us = (uint32_t)(timestamp / 1000);
+
+    // Frames that ended before the peak window leave it, oldest first
+    for (int slot; (slot = fa_extremum_front(&stats->peak)) >= 0 &&
+                   now_us - stats->frame_end_us[slot] > FA_PEAK_WINDOW_NS / 1000;)
+        extremum_evict(&stats->peak, slot, size);
+
+    if (!result->unique)
+        return false;
+
+    const uint64_t now = timestamp;
+    bool added = false;
+    if (stats->last_unique_frame_time != 0) {
+        uint64_t ft_ns = now - stats->last_unique_frame_time;
+        uint64_t ft_us64 = (ft_ns + 500) / 1000;
+        uint32_t ft_us = ft_us64 > UINT32_MAX ? UINT32_MAX : (uint32_t)ft_us64;
+        double ft = ft_us / 1000.0;
+        int pos = stats->frametime_pos;
+
+        // History full: the slot about to be overwritten leaves the window
+        if (stats->window_count == size) {
+            stats->window_sum_us -= stats->frametime_us[pos];
+            stats->window_count--;
+        }
+
+        // The recent distribution holds what the history stores, so the
+        // value removed later is the one added now
+        if (stats->frametime_count == size) {
+            fa_ft_histogram_remove(&stats->recent, stats->frametime_us[pos] * 1000ULL);
+            extremes_evict(stats, pos);
+        }
+        fa_ft_histogram_add(&stats->recent, ft_us * 1000ULL);
+        // The frame spanning a stall says nothing about the game's pacing
+        uint8_t pace = FA_PACE_OK;
+        if (!stats->session_gap) {
+            fa_ft_histogram_add(&stats->session, ft_ns);
+            pace = fa_pacing_unique(&stats->pacing, ft_ns);
+        }
+        stats->session_gap = false;
+        stats->pacing_class[pos] = pace;
+
+        stats->frametime_us[pos] = ft_us;
+        stats->frame_end_us[pos] = now_us;
+        if (result->tearing)
+            stats->tearing[pos >> 3] |= (uint8_t)(1u << (pos & 7));
+        else
+            stats->tearing[pos >> 3] &= (uint8_t)~(1u << (pos & 7));
+
+        // Smoothed frametime: EMA (exponential moving average)
+        // alpha=0.15 — responsive enough to show stutters, smooth enough to reduce noise
+        {
+            const double alpha = 0.15;
+            if (stats->ema_frametime <= 0.0)
+                stats->ema_frametime = ft; // init to first value
+            else
+                stats->ema_frametime = stats->ema_frametime * (1.0 - alpha) + ft * alpha;
+            stats->smoothed[pos] = saturate_u16(stats->ema_frametime * FA_SMOOTHED_UNITS_PER_MS);
+        }
+
+        stats->frametime_pos = (pos + 1) % size;
+        if (stats->frametime_count < size)
+            stats->frametime_count++;
+
+        // Slide the 1 s window: add this frame, drop frames that ended too long ago
+        stats->window_sum_us += ft_us;
+        stats->window_count++;
+        while (stats->window_count > 1) {
+            int oldest = (stats->frametime_pos - stats->window_count + size) % size;
+            if (now_us - stats->frame_end_us[oldest] < STATS_WINDOW_NS / 1000)
+                break;
+            stats->window_sum_us -= stats->frametime_us[oldest];
+            stats->window_count--;
+        }
+
+        // FPS for this graph point: frames per second of capture time in the window
+        stats->fps[pos] = saturate_u16(fa_stats_fps(stats));
+
+        extremum_push(&stats->smoothed_min, stats->smoothed, pos, false, size);
+        extremum_push(&stats->smoothed_max, stats->smoothed, pos, true, size);
+        extremum_push(&stats->fps_min, stats->fps, pos, false, size);
+        extremum_push(&stats->fps_max, stats->fps, pos, true, size);
+        extremum_push(&stats->peak, stats->frametime_us, pos, true, size);
+        added = true;
+    }
+    stats->last_unique_frame_time = now;
+    return added;
+}
@@ -0,0 +1,230 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "fps-analyzer-api.h"
+
+// Frame analysis without libobs: unique frame / tearing detection on luma
+// rows and the frametime + FPS statistics built from it. Building blocks of
+// the C API in fps-analyzer-api.h, also used directly by the offline tools.
+// Not thread-safe; callers serialize access.
+
+#define STATS_WINDOW_NS 1000000000ULL // rolling FPS window: 1 s of capture time
+#define FA_PEAK_WINDOW_NS 5000000000ULL // frametime peak: last 5 s of capture time
+
+// ANALYZE_TILED: the luma ROI is split into tiles of FA_TILE_WIDTH x
+// FA_TILE_HEIGHT bytes (4 KiB, so a tile and its reference stay in L1)
+#define FA_TILE_WIDTH 256
+#define FA_TILE_HEIGHT 16
+// ANALYZE_DIFF with analysis_threads > 1: frames smaller than this stay on
+// one thread, where waking the pool would cost more than it saves
+#define FA_MT_MIN_PIXELS (1920 * 1080)
+#define FA_MT_MAX_THREADS 16
+
+// fa_detector_tile_map() entries
+#define FA_TILE_UNCHANGED 0
+#define FA_TILE_CHANGED 1   // % of differing bytes >= sensitivity
+#define FA_TILE_SKIPPED 2   // not compared, the frame was already unique
+
+// Unique frame and tearing detection for one video stream
+struct fa_detector {
+    // Settings, may be changed between frames
+    analyze_method_t analyze_method;
+    double sensitivity;          // % of ROI bytes that must change
+    bool enable_tearing_detection;
+    double tearing_sensitivity;  // % of a line that must change
+    uint32_t sample_rows;        // ANALYZE_SAMPLED: rows per frame (>= 1)
+    bool sample_jitter;
+    uint32_t sample_column_step; // >= 1
+    uint32_t analysis_threads;   // ANALYZE_DIFF: 1..FA_MT_MAX_THREADS
+    struct fa_thread_pool *pool; // analysis_threads - 1 workers, created on demand
+    // Double-buffered luma reference: the current frame's rows are written to
+    // luma_frames[luma_cur] while being compared with the other buffer, then
+    // the two swap roles. Holds the whole ROI in full frame mode, otherwise
+    // only the tearing lines + last line; sampled: the sampled rows (packed
+    // to width / column step bytes) followed by the tearing lines.
+    uint8_t *luma_frames[2];
+    size_t luma_frames_size;
+    int luma_cur;
+    bool luma_ref_valid;
+    uint32_t luma_width;
+    uint32_t luma_rows;
+    int tearing_history[5];
+    int tearing_history_pos;
+    // ANALYZE_TILED: state of each tile of the last frame, row-major,
+    // tile_cols x tile_rows
+    uint8_t *tile_map;
+    uint32_t tile_cols;
+    uint32_t tile_rows;
+    // ANALYZE_SAMPLED: source rows for the current height and pattern
+    uint32_t *sample_ys;
+    uint32_t sample_count;
+    uint32_t sample_height;
+    bool sample_ys_jitter;
+    uint32_t sample_step; // column step the reference was taken with
+};
+
+// Extract luma from one frame (data/linesize: the plane described by format),
+// compare with the previous frame and detect tearing.
+// Returns false for FA_FORMAT_NONE.
+bool fa_detector_process(struct fa_detector *det, fa_pixel_format_t format,
+                         const uint8_t *data, uint32_t linesize,
+                         uint32_t width, uint32_t height,
+                         struct fa_frame_result *result);
+void fa_detector_free(struct fa_detector *det);
+// FA_TILE_* state of each tile of the latest ANALYZE_TILED frame, row-major,
+// cols x rows; NULL before the first one. Valid until the next process call.
+const uint8_t *fa_detector_tile_map(const struct fa_detector *det, uint32_t *cols, uint32_t *rows);
+// Heap memory held by the detector's buffers
+size_t fa_detector_memory(const struct fa_detector *det);
+// ANALYZE_SAMPLED row pattern: count rows of a height-row frame, one per
+// stratum of height / count rows (its centre, or a fixed pseudo-random row
+// with jitter). count is clamped to height; returns the number written.
+uint32_t fa_sample_rows(uint32_t height, uint32_t count, bool jitter, uint32_t *ys);
+// Tearing step of fa_detector_process(): diff counts of the top, middle and
+// bottom lines, each roi_width bytes wide. Updates the 5-frame history.
+bool fa_detect_tearing(struct fa_detector *det, const size_t line_diff[3], int roi_width);
+
+// Frametime distribution in constant memory with O(1) add/remove, HDR
+// histogram style: values in microseconds, exact below 128 us, then 128
+// buckets per power of two, so a bucket is at most 1/128 of its values wide.
+// Frametimes of 2^FA_FT_HIST_MAX_BITS us (16.7 s) and more share the last
+// bucket.
+#define FA_FT_HIST_SUB_BITS 7
+#define FA_FT_HIST_MAX_BITS 24
+#define FA_FT_HIST_BUCKETS ((FA_FT_HIST_MAX_BITS - FA_FT_HIST_SUB_BITS + 1) << FA_FT_HIST_SUB_BITS)
+
+struct fa_ft_histogram {
+    uint32_t buckets[FA_FT_HIST_BUCKETS];
+    uint64_t count;
+    uint64_t sum_ns;
+};
+
+void fa_ft_histogram_add(struct fa_ft_histogram *hist, uint64_t ns);
+// ns must have been added before
+void fa_ft_histogram_remove(struct fa_ft_histogram *hist, uint64_t ns);
+void fa_ft_histogram_clear(struct fa_ft_histogram *hist);
+// Average, percentiles and lows; one pass over the buckets
+void fa_ft_histogram_summary(const struct fa_ft_histogram *hist, struct fa_frametime_stats *out);
+
+// Frame pacing: unique frametimes counted in refreshes of the output
+#define FA_PACE_WINDOW 120       // unique frames the cadence is detected over
+#define FA_PACE_MAX_REFRESHES 15 // longer frames count as this many
+
+struct fa_pacing {
+    uint64_t last_frame_ns; // capture time of the previous frame, unique or not
+    uint64_t refresh_ns;    // estimated refresh interval, 0 until known
+    int refresh_rejects;    // consecutive intervals too far from refresh_ns
+    // Refreshes per unique frame of the last window_count frames: a ring,
+    // its sum and a count per value, so the cadence and the share of frames
+    // on it cost O(1) per frame
+    uint8_t window[FA_PACE_WINDOW];
+    int window_pos;
+    int window_count;
+    int window_sum;
+    uint16_t window_counts[FA_PACE_MAX_REFRESHES + 1];
+    uint64_t violations;
+    uint64_t stutters;
+};
+
+// Every analyzed frame: refines the refresh interval
+void fa_pacing_frame(struct fa_pacing *pacing, uint64_t timestamp);
+// Every unique frame with a frametime, after fa_pacing_frame(); returns its
+// fa_pace_t (FA_PACE_OK while the refresh interval is unknown)
+uint8_t fa_pacing_unique(struct fa_pacing *pacing, uint64_t frametime_ns);
+// Forget the window (source stalled); the refresh estimate is kept
+void fa_pacing_clear_window(struct fa_pacing *pacing);
+void fa_pacing_summary(const struct fa_pacing *pacing, struct fa_pacing_stats *out);
+
+// Sliding minimum or maximum of a history array: a monotonic deque of
+// history slots, oldest first, whose values only get worse towards the
+// back, so the front is the extremum. Values stay in the history ring; an
+// entry leaves when its slot is overwritten or its frame ages out. Every
+// frame is pushed and evicted at most once: O(1) amortized per frame and
+// O(1) to read, instead of a scan of the history.
+struct fa_extremum {
+    uint16_t *slot; // ring of history slots, history_size entries
+    int head;
+    int count;
+};
+
+// Slot holding the extremum, -1 if empty
+static inline int fa_extremum_front(const struct fa_extremum *ex)
+{
+    return ex->count > 0 ? ex->slot[ex->head] : -1;
+}
+
+// Frametime history of unique frames plus a rolling window over the last
+// STATS_WINDOW_NS of capture time. The window is the last window_count
+// history entries (before frametime_pos), kept with integer sums so adding
+// and removing entries never drifts.
+//
+// The history is a ring of history_size entries in compact arrays,
+// (re)allocated by the first push after a length change. Per entry: raw
+// frametime and capture time in microseconds, the smoothed frametime in
+// fixed point, the FPS as an integer, the pacing class and a tearing bit.
+// A zeroed fa_stats is ready to use with the default length; release it
+// with fa_stats_free().
+struct fa_stats {
+    uint64_t last_unique_frame_time;
+    bool tearing_detected; // result of the latest frame
+    int history_length;    // requested entries, 0 = FA_HISTORY_DEFAULT
+    int history_size;      // entries allocated
+    uint32_t *frametime_us;
+    uint32_t *frame_end_us;  // capture time, wraps after 71 minutes (compare by difference)
+    uint16_t *smoothed;      // FA_SMOOTHED_UNITS_PER_MS per ms, saturating
+    uint16_t *fps;           // FPS of the window at this frame
+    uint8_t *pacing_class;   // fa_pace_t
+    uint8_t *tearing;        // bitset, bit slot & 7 of byte slot / 8
+    int frametime_pos;
+    int frametime_count;
+    double ema_frametime; // EMA state for frametime smoothing
+    int window_count;
+    uint64_t window_sum_us;
+    // Distribution of the whole session and of the history entries
+    struct fa_ft_histogram session;
+    struct fa_ft_histogram recent;
+    bool session_gap; // next frametime spans a stall, keep it out of the session
+    struct fa_pacing pacing;
+    // Graph extremes over the history, and the raw frametime peak over the
+    // last FA_PEAK_WINDOW_NS
+    struct fa_extremum smoothed_min;
+    struct fa_extremum smoothed_max;
+    struct fa_extremum fps_min;
+    struct fa_extremum fps_max;
+    struct fa_extremum peak;
+};
+
+// Account one analyzed frame captured at timestamp (ns). Returns true if it
+// added a frametime to the history (unique frame with a predecessor).
+bool fa_stats_push(struct fa_stats *stats, const struct fa_frame_result *result, uint64_t timestamp);
+// Drop the history and the window (source stalled); the frame clock is kept
+void fa_stats_clear_history(struct fa_stats *stats);
+// Empty the session distribution and pacing counters
+void fa_stats_reset_session(struct fa_stats *stats);
+// Average over the rolling window, 0 if empty
+double fa_stats_fps(const struct fa_stats *stats);
+double fa_stats_frametime_ms(const struct fa_stats *stats);
+void fa_stats_range(const struct fa_stats *stats, struct fa_history_range *out);
+// Takes effect with the next push; a different length drops the history.
+// length is clamped to FA_HISTORY_MIN..FA_HISTORY_MAX, 0 = default.
+void fa_stats_set_history_length(struct fa_stats *stats, int length);
+// Clamped requested length: the history size from the next push on
+int fa_stats_history_length(const struct fa_stats *stats);
+// Linearized history, oldest first, as fa_copy_history() describes
+int fa_stats_copy_history(const struct fa_stats *stats, uint16_t *smoothed, uint32_t *raw_us,
+                          uint16_t *fps, uint8_t *tearing, uint8_t *pacing, int max_count);
+// Bytes of the history arrays
+size_t fa_stats_memory(const struct fa_stats *stats);
+void fa_stats_free(struct fa_stats *stats);
+
+// History index of the newest entry (frametime_count must be > 0)
+static inline int fa_stats_newest(const struct fa_stats *stats)
+{
+    return (stats->frametime_pos + stats->history_size - 1) % stats->history_size;
+}
+
+static inline bool fa_stats_tearing_at(const struct fa_stats *stats, int slot)
+{
+    return (stats->tearing[slot >> 3] >> (slot & 7)) & 1;
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// Background CSV writer. The caller (video_tick) only stores a record in a
+// lock-free single-producer queue; a writer thread opens the file, formats
+// records in batches and writes them into a fixed-size ring file.
+//
+// Ring file: max_rows fixed-width lines "unix_time,fps,frametime_ms\n",
+// each CSV_RECORD_SIZE bytes, overwritten in place once the file is full.
+// Lines are in ring order; sort by the first column for chronological order.
+
+#define CSV_RECORD_SIZE 28 // "1700000000.123,0060,0016.67\n"
+
+struct csv_writer;
+
+// Starts the writer thread; the file is opened on that thread.
+// clear: start with an empty file instead of continuing an existing ring.
+// Without it, an existing file that is not a ring is moved to <path>.bak.
+struct csv_writer *csv_writer_create(const char *path, int max_rows, bool clear);
+// Writes the remaining records, closes the file and joins the thread
+void csv_writer_destroy(struct csv_writer *writer);
+const char *csv_writer_path(const struct csv_writer *writer);
+
+// Never blocks and does no I/O. Returns false if the queue was full and the
+// record was dropped.
+bool csv_writer_push(struct csv_writer *writer, double unix_time, int fps, double frametime_ms);
@@ -0,0 +1,202 @@
+#include "fps-analyzer-eventlog.h"
+#include <new>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+struct fa_event_log {
+    struct fa_event_log_header *header;
+    struct fa_event_record *records;
+    uint64_t capacity;
+    uint64_t write_count; // private copy, header->write_count mirrors it
+    size_t size;
+};
+
+// --- Platform mapping; the view stays valid after the handles are closed ---
+
+#ifdef _WIN32
+static HANDLE open_utf8(const char *path, bool write)
+{
+    wchar_t wpath[MAX_PATH * 2];
+    if (!MultiByteToWideChar(CP_UTF8, 0, path, -1, wpath, MAX_PATH * 2))
+        return INVALID_HANDLE_VALUE;
+    return CreateFileW(wpath, write ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+                       FILE_SHARE_READ | (write ? 0 : FILE_SHARE_WRITE), NULL,
+                       write ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+}
+
+static void *map_path(const char *path, size_t create_size, size_t *size)
+{
+    const bool write = create_size != 0;
+    HANDLE file = open_utf8(path, write);
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+    LARGE_INTEGER li;
+    if (write) {
+        li.QuadPart = (LONGLONG)create_size;
+    } else if (!GetFileSizeEx(file, &li) || li.QuadPart == 0) {
+        CloseHandle(file);
+        return NULL;
+    }
+    HANDLE mapping = CreateFileMappingW(file, NULL, write ? PAGE_READWRITE : PAGE_READONLY,
+                                        (DWORD)(li.QuadPart >> 32), (DWORD)li.QuadPart, NULL);
+    void *p = mapping ? MapViewOfFile(mapping, write ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (mapping)
+        CloseHandle(mapping);
+    CloseHandle(file);
+    *size = (size_t)li.QuadPart;
+    return p;
+}
+
+static void unmap(void *p, size_t size)
+{
+    (void)size;
+    FlushViewOfFile(p, 0);
+    UnmapViewOfFile(p);
+}
+#else
+static void *map_path(const char *path, size_t create_size, size_t *size)
+{
+    const bool write = create_size != 0;
+    int fd = write ? open(path, O_RDWR | O_CREAT | O_TRUNC, 0644) : open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    if (write) {
+        if (ftruncate(fd, (off_t)create_size) != 0) {
+            close(fd);
+            return NULL;
+        }
+        *size = create_size;
+    } else {
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            close(fd);
+            return NULL;
+        }
+        *size = (size_t)st.st_size;
+    }
+    void *p = mmap(NULL, *size, write ? PROT_READ | PROT_WRITE : PROT_READ,
+                   write ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+    close(fd);
+    return p == MAP_FAILED ? NULL : p;
+}
+
+static void unmap(void *p, size_t size)
+{
+    msync(p, size, MS_ASYNC);
+    munmap(p, size);
+}
+#endif
+
+// --- Writer ---
+
+struct fa_event_log *fa_event_log_create(const char *path, uint64_t capacity, uint64_t now_timestamp_ns)
+{
+    if (capacity == 0)
+        capacity = FA_EVENT_LOG_DEFAULT_CAPACITY;
+    size_t size = sizeof(struct fa_event_log_header) + (size_t)capacity * sizeof(struct fa_event_record);
+    size_t mapped_size = 0;
+    void *p = map_path(path, size, &mapped_size);
+    if (!p)
+        return NULL;
+
+    struct fa_event_log *log = new (std::nothrow) fa_event_log();
+    if (!log) {
+        unmap(p, mapped_size);
+        return NULL;
+    }
+    log->header = (struct fa_event_log_header *)p;
+    log->records = (struct fa_event_record *)(log->header + 1);
+    log->capacity = capacity;
+    log->size = mapped_size;
+
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    struct fa_event_log_header *h = log->header;
+    memcpy(h->magic, FA_EVENT_LOG_MAGIC, sizeof(h->magic));
+    h->version = FA_EVENT_LOG_VERSION;
+    h->record_size = sizeof(struct fa_event_record);
+    h->capacity = capacity;
+    h->write_count = 0;
+    h->start_unix_ns = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+    h->start_timestamp_ns = now_timestamp_ns;
+    return log;
+}
+
+void fa_event_log_append(struct fa_event_log *log, uint64_t timestamp_ns,
+                         const struct fa_frame_result *result)
+{
+    uint64_t ft_us = result->frametime_ns / 1000;
+    double diff = result->diff_percent * 100.0 + 0.5;
+
+    struct fa_event_record *rec = &log->records[log->write_count % log->capacity];
+    rec->timestamp_ns = timestamp_ns;
+    rec->frametime_us = ft_us > UINT32_MAX ? UINT32_MAX : (uint32_t)ft_us;
+    rec->diff_centi_pct = diff > 10000.0 ? 10000 : (uint16_t)diff;
+    rec->flags = (result->tearing ? FA_EVENT_TEARING : 0) |
+                 (result->frametime_ns == 0 ? FA_EVENT_FIRST : 0);
+    rec->reserved = 0;
+
+    // Count after the record, so a crash never exposes a half-written slot
+    log->header->write_count = ++log->write_count;
+}
+
+void fa_event_log_close(struct fa_event_log *log)
+{
+    if (!log)
+        return;
+    unmap(log->header, log->size);
+    delete log;
+}
+
+// --- Reader ---
+
+bool fa_event_log_open_view(const char *path, struct fa_event_log_view *view,
+                            char *error, size_t error_size)
+{
+    memset(view, 0, sizeof(*view));
+    size_t size = 0;
+    void *p = map_path(path, 0, &size);
+    if (!p) {
+        snprintf(error, error_size, "cannot open %s", path);
+        return false;
+    }
+
+    const struct fa_event_log_header *h = (const struct fa_event_log_header *)p;
+    const char *problem = NULL;
+    if (size < sizeof(*h) || memcmp(h->magic, FA_EVENT_LOG_MAGIC, sizeof(h->magic)) != 0)
+        problem = "not an FPS Analyzer event log";
+    else if (h->version != FA_EVENT_LOG_VERSION || h->record_size != sizeof(struct fa_event_record))
+        problem = "unsupported event log version";
+    else if (h->capacity == 0 || (size - sizeof(*h)) / sizeof(struct fa_event_record) < h->capacity)
+        problem = "truncated event log";
+    if (problem) {
+        snprintf(error, error_size, "%s: %s", path, problem);
+        unmap(p, size);
+        return false;
+    }
+
+    view->header = h;
+    view->records = (const struct fa_event_record *)(h + 1);
+    view->count = h->write_count < h->capacity ? h->write_count : h->capacity;
+    view->first = h->write_count < h->capacity ? 0 : h->write_count % h->capacity;
+    view->mapping = p;
+    view->size = size;
+    return true;
+}
+
+void fa_event_log_close_view(struct fa_event_log_view *view)
+{
+    if (view->mapping)
+        unmap(view->mapping, view->size);
+    memset(view, 0, sizeof(*view));
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "fps-analyzer-api.h"
+
+// Binary per-frame event log: one 16-byte record per unique frame in a
+// fixed-size memory-mapped ring file. Appending is a memory store, no
+// syscalls. Not thread-safe; one writer thread per log.
+//
+// File: 64-byte header, then capacity records. Record n (0-based, counting
+// every record ever appended) lives in slot n % capacity; once write_count
+// exceeds capacity the oldest records are overwritten.
+
+#define FA_EVENT_LOG_MAGIC "FAEVLOG1"
+#define FA_EVENT_LOG_VERSION 1
+#define FA_EVENT_LOG_DEFAULT_CAPACITY (1u << 19) // 8 MiB, ~2.4 h at 60 fps
+
+#define FA_EVENT_TEARING 0x01 // tearing detected on this frame
+#define FA_EVENT_FIRST 0x02   // no previous unique frame, frametime_us is 0
+
+struct fa_event_record {
+    uint64_t timestamp_ns;  // capture time, same clock as fa_push_frame()
+    uint32_t frametime_us;  // since the previous unique frame (saturated)
+    uint16_t diff_centi_pct; // % of ROI bytes changed, in 0.01 % units
+    uint8_t flags;           // FA_EVENT_*
+    uint8_t reserved;
+};
+
+struct fa_event_log_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t capacity;           // records
+    uint64_t write_count;        // records appended so far
+    uint64_t start_unix_ns;      // wall clock when the log was created...
+    uint64_t start_timestamp_ns; // ...and the capture clock at that moment
+    uint8_t reserved[16];
+};
+
+static_assert(sizeof(struct fa_event_record) == 16, "event record layout");
+static_assert(sizeof(struct fa_event_log_header) == 64, "event log header layout");
+
+struct fa_event_log;
+
+// Create (truncate) a log with room for capacity records. now_timestamp_ns
+// is the capture clock "now", used to map timestamps to wall time.
+struct fa_event_log *fa_event_log_create(const char *path, uint64_t capacity, uint64_t now_timestamp_ns);
+void fa_event_log_append(struct fa_event_log *log, uint64_t timestamp_ns,
+                         const struct fa_frame_result *result);
+void fa_event_log_close(struct fa_event_log *log);
+
+// Read-only view of a log file, records in chronological order:
+// record i is records[(first + i) % capacity] for i < count
+struct fa_event_log_view {
+    const struct fa_event_log_header *header;
+    const struct fa_event_record *records;
+    uint64_t first;
+    uint64_t count;
+    void *mapping; // internal
+    size_t size;
+};
+
+// Returns false (with a message in error) if the file is missing or not a log
+bool fa_event_log_open_view(const char *path, struct fa_event_log_view *view,
+                            char *error, size_t error_size);
+void fa_event_log_close_view(struct fa_event_log_view *view);
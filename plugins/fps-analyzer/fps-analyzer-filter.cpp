@@ -2,6 +2,11 @@
 #include <graphics/graphics.h>
 #include <graphics/vec4.h>
 #include <util/platform.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
@@ -11,346 +16,598 @@
 #endif
 
 #include "fps-shared-data.h"
+#include "fps-analyzer-kernels.h"
+#include "fps-analyzer-api.h"
+#include "fps-analyzer-csv.h"
+#include "fps-analyzer-eventlog.h"
+
+// Channel registry — read by fps-analyzer-overlay.cpp. Each channel is a
+// triple buffer: middle holds the index of the middle buffer plus
+// SHARED_FRESH when it carries a snapshot the reader has not picked up yet.
+#define SHARED_FRESH 4
+
+struct fps_shared_channel {
+    struct fps_shared_data buffers[3];
+    int back;  // writer-owned
+    int front; // reader-owned
+    std::atomic<long> middle;
+    // Registry fields, under g_registry_lock
+    bool in_use;
+    uint64_t registered; // registration order, the oldest is the default
+    char name[FPS_SHARED_NAME_MAX];
+};
+
+static std::mutex g_registry_lock;
+static struct fps_shared_channel *g_channels[FPS_SHARED_MAX_CHANNELS];
+static void *g_channel_blocks[FPS_SHARED_MAX_CHANNELS]; // bzalloc'd, g_channels[i] aligned inside
+static uint64_t g_registrations = 0;
+static std::atomic<long> g_active_filter_count{0};
+static std::atomic<long> g_graph_bytes{0}; // graph arrays of all buffers
+
+#define CACHE_ALIGN(n) (((n) + FPS_SHARED_CACHE_LINE - 1) & ~(size_t)(FPS_SHARED_CACHE_LINE - 1))
+
+// Graph arrays of capacity entries back to back, each on its own cache
+// lines, in the order the overlay reads them. Returns the bytes to allocate
+// for them (alignment slack included); with a block, points the arrays of
+// data into it.
+static size_t graph_layout(struct fps_shared_data *data, void *block, int capacity, bool with_raw)
+{
+    const size_t n = (size_t)capacity;
+    const size_t ft = 0;
+    const size_t fps = ft + CACHE_ALIGN(n * sizeof(uint16_t));
+    const size_t pacing = fps + CACHE_ALIGN(n * sizeof(uint16_t));
+    const size_t tearing = pacing + CACHE_ALIGN(n);
+    const size_t raw = tearing + CACHE_ALIGN((n + 7) / 8);
+    const size_t end = raw + (with_raw ? n * sizeof(uint32_t) : 0);
+    if (block) {
+        uint8_t *base = (uint8_t *)CACHE_ALIGN((uintptr_t)block);
+        data->graph_frametimes = (uint16_t *)(base + ft);
+        data->graph_fps = (uint16_t *)(base + fps);
+        data->graph_pacing = base + pacing;
+        data->graph_tearing = base + tearing;
+        data->graph_frametimes_raw = with_raw ? (uint32_t *)(base + raw) : NULL;
+        data->graph_capacity = capacity;
+        data->graph_block = block;
+    }
+    return end + FPS_SHARED_CACHE_LINE - 1;
+}
 
-// Global shared data — read by fps-analyzer-overlay.cpp
-struct fps_shared_data g_fps_shared = {0, 0.0, false, 0, 0, -1, {}, 0};
+struct fps_shared_channel *fps_shared_register(void)
+{
+    struct fps_shared_channel *channel = NULL;
+    std::lock_guard<std::mutex> guard(g_registry_lock);
+    for (int i = 0; i < FPS_SHARED_MAX_CHANNELS && !channel; ++i) {
+        if (!g_channels[i]) {
+            // Cache-line aligned, as the buffers inside are
+            g_channel_blocks[i] = bzalloc(sizeof(struct fps_shared_channel) + FPS_SHARED_CACHE_LINE - 1);
+            g_channels[i] = new ((void *)CACHE_ALIGN((uintptr_t)g_channel_blocks[i])) fps_shared_channel();
+            for (int b = 0; b < 3; ++b)
+                g_channels[i]->buffers[b].unsupported_format = -1;
+            g_channels[i]->back = 0;
+            g_channels[i]->front = 2;
+            g_channels[i]->middle.store(1);
+        } else if (g_channels[i]->in_use)
+            continue;
+        channel = g_channels[i];
+    }
+    if (channel) {
+        // A reused slot keeps its buffers and indices: an overlay may still
+        // hold the channel and read its front buffer. The new writer's first
+        // publish replaces the previous filter's last snapshot, every field
+        // of it, as each publish does.
+        channel->in_use = true;
+        channel->registered = ++g_registrations;
+        snprintf(channel->name, sizeof(channel->name), "FPS Analyzer %llu",
+                 (unsigned long long)channel->registered);
+    }
+    return channel;
+}
+
+void fps_shared_unregister(struct fps_shared_channel *channel)
+{
+    if (!channel)
+        return;
+    std::lock_guard<std::mutex> guard(g_registry_lock);
+    channel->in_use = false;
+}
+
+void fps_shared_set_name(struct fps_shared_channel *channel, const char *name)
+{
+    std::lock_guard<std::mutex> guard(g_registry_lock);
+    snprintf(channel->name, sizeof(channel->name), "%s", name);
+}
+
+struct fps_shared_data *fps_shared_begin_write(struct fps_shared_channel *channel)
+{
+    return &channel->buffers[channel->back];
+}
+
+void fps_shared_reserve(struct fps_shared_data *data, int capacity, bool with_raw)
+{
+    bool has_raw = data->graph_frametimes_raw != NULL;
+    if (capacity <= data->graph_capacity && has_raw == with_raw)
+        return;
+    if (capacity < data->graph_capacity)
+        capacity = data->graph_capacity;
+    size_t bytes = graph_layout(data, NULL, capacity, with_raw);
+    bfree(data->graph_block);
+    graph_layout(data, bmalloc(bytes), capacity, with_raw);
+    g_graph_bytes += (long)bytes - (long)data->graph_block_bytes;
+    data->graph_block_bytes = bytes;
+}
+
+void fps_shared_publish(struct fps_shared_channel *channel)
+{
+    long prev = channel->middle.exchange(channel->back | SHARED_FRESH);
+    channel->back = (int)(prev & ~SHARED_FRESH);
+}
+
+struct fps_shared_channel *fps_shared_find(const char *name)
+{
+    struct fps_shared_channel *found = NULL;
+    std::lock_guard<std::mutex> guard(g_registry_lock);
+    for (int i = 0; i < FPS_SHARED_MAX_CHANNELS; ++i) {
+        struct fps_shared_channel *c = g_channels[i];
+        if (!c || !c->in_use)
+            continue;
+        if (name && name[0]) {
+            if (strcmp(c->name, name) == 0) {
+                found = c;
+                break;
+            }
+        } else if (!found || c->registered < found->registered) {
+            found = c;
+        }
+    }
+    return found;
+}
+
+const struct fps_shared_data *fps_shared_read(struct fps_shared_channel *channel)
+{
+    if (channel->middle.load() & SHARED_FRESH) {
+        long prev = channel->middle.exchange(channel->front);
+        channel->front = (int)(prev & ~SHARED_FRESH);
+    }
+    return &channel->buffers[channel->front];
+}
+
+int fps_shared_list(char names[][FPS_SHARED_NAME_MAX], int max_names)
+{
+    struct fps_shared_channel *sorted[FPS_SHARED_MAX_CHANNELS];
+    int count = 0;
+    std::lock_guard<std::mutex> guard(g_registry_lock);
+    for (int i = 0; i < FPS_SHARED_MAX_CHANNELS; ++i) {
+        struct fps_shared_channel *c = g_channels[i];
+        if (!c || !c->in_use)
+            continue;
+        // Insertion sort by registration order
+        int j = count++;
+        while (j > 0 && sorted[j - 1]->registered > c->registered) {
+            sorted[j] = sorted[j - 1];
+            --j;
+        }
+        sorted[j] = c;
+    }
+    if (count > max_names)
+        count = max_names;
+    for (int i = 0; i < count; ++i)
+        snprintf(names[i], FPS_SHARED_NAME_MAX, "%s", sorted[i]->name);
+    return count;
+}
+
+int fps_shared_active_filters(void)
+{
+    return (int)g_active_filter_count.load();
+}
+
+size_t fps_shared_memory_used(void)
+{
+    size_t bytes = 0;
+    std::lock_guard<std::mutex> guard(g_registry_lock);
+    for (int i = 0; i < FPS_SHARED_MAX_CHANNELS; ++i) {
+        if (g_channels[i])
+            bytes += sizeof(struct fps_shared_channel);
+    }
+    return bytes + (size_t)g_graph_bytes.load();
+}
+
+void fps_shared_free_all(void)
+{
+    std::lock_guard<std::mutex> guard(g_registry_lock);
+    for (int i = 0; i < FPS_SHARED_MAX_CHANNELS; ++i) {
+        if (g_channels[i]) {
+            for (int b = 0; b < 3; ++b)
+                bfree(g_channels[i]->buffers[b].graph_block);
+        }
+        bfree(g_channel_blocks[i]);
+        g_channel_blocks[i] = NULL;
+        g_channels[i] = NULL;
+    }
+    g_graph_bytes = 0;
+}
 
 // Declare overlay info for registration in overlay file
 extern struct obs_source_info fps_overlay_source_info;
 
 #define FPS_CSV_HISTORY_LIMIT 300
-#define ROLLING_MAX 120 // max 2 sekundy przy 60 FPS
-#define FRAMETIME_HISTORY 960
+#define READBACK_RING_MAX 4
+#define READBACK_STALL_NS 1000000ULL // a map slower than 1 ms waited on the GPU
+#define WORKER_QUEUE_SLOTS 4 // one frame being analyzed + up to 3 queued
+
+// Worker job slot states; the slot state word is (sequence << 2) | state so a
+// CAS also fails if the slot was recycled in between
+#define JOB_FREE 0
+#define JOB_WRITING 1
+#define JOB_QUEUED 2
+#define JOB_BUSY 3
+#define JOB_SEQ_MASK 0x1FFFFFFFUL
+
+// One GPU->CPU staging surface of the readback ring
+struct readback_slot {
+    gs_stagesurf_t *surface;
+    uint64_t render_time; // os_gettime_ns() when the frame was rendered
+    bool pending;         // staged, not mapped yet
+};
 
-// Dodaj enum do wyboru metody analizy
-typedef enum {
-    ANALYZE_LAST_LINE = 0,
-    ANALYZE_DIFF = 1
-} analyze_method_t;
+// Frame rows copied out of a video callback for the analysis worker.
+// In last-line mode only the analyzed rows are kept, as a 1- or 3-row image
+// (rows 0, h/2, h-1 of a 3-row image are exactly those rows). The settings
+// the rows were picked with travel with them.
+struct analysis_job {
+    fa_pixel_format_t format;
+    uint32_t width;
+    uint32_t height;
+    uint32_t linesize;
+    uint64_t timestamp;
+    struct fa_settings settings;
+    long settings_gen;
+    uint8_t *data;
+    size_t capacity;
+};
 
 // Prototypes
-static void keep_last_n_lines(const char *csv_path, int n);
-static void build_csv_path(const char *output_path, char *csv_path, size_t csv_path_size);
+static void build_output_path(const char *output_path, const char *ext, char *out_path, size_t out_path_size);
 
 struct fps_analyzer_filter {
     obs_source_t *context;
+    // Overlay channel, NULL if the registry is full
+    struct fps_shared_channel *channel;
+    char channel_name[FPS_SHARED_NAME_MAX];
     char output_path[512];
     double update_interval;
-    uint64_t last_unique_frame_time;
     bool clear_csv_on_start;
     bool enable_csv;
-    uint64_t rolling_times[ROLLING_MAX];
-    int rolling_count;
-    int rolling_start;
+    struct csv_writer *csv; // owned by video_tick
+    // Binary per-frame log, owned by whichever thread runs analyze_frame().
+    // fps_analyzer_update() writes the requested settings under
+    // event_log_lock and bumps event_log_gen; that thread copies them under
+    // the lock and reopens the log when it sees a new generation.
+    std::mutex event_log_lock;
+    bool enable_event_log;    // requested, under event_log_lock
+    char event_log_path[512]; // requested, under event_log_lock
+    std::atomic<long> event_log_gen;
+    long event_log_applied_gen;
+    struct fa_event_log *event_log;
     uint64_t last_write_time;
-    double frametime_history[FRAMETIME_HISTORY];
-    int frametime_pos;
-    int frametime_count;
-    analyze_method_t analyze_method;
-    double sensitivity;
-    uint8_t *prev_frame;
-    size_t prev_frame_size;
-    int tearing_detected;
-    bool enable_tearing_detection;
-    double tearing_sensitivity;
-    uint8_t *prev_lines[3];
-    size_t prev_lines_size;
-    int tearing_history[5];
-    int tearing_history_pos;
-    // Dynamic luma buffer (replaces static buffers)
-    uint8_t *luma_buffer;
-    size_t luma_buffer_size;
-    // GPU staging resources for sync sources (video_render path)
+    // Frames are pushed from the video thread (or the worker), video_tick
+    // reads the statistics
+    fa_analyzer_t *analyzer;
+    // Analysis settings. fps_analyzer_update() writes them under
+    // settings_lock and bumps settings_gen. The video callback copies them
+    // into frame_settings when the generation changes and picks the rows of
+    // each frame from that copy; the analysis thread hands the same copy to
+    // the analyzer before the frame, so rows and detector always agree.
+    std::mutex settings_lock;
+    struct fa_settings settings; // requested, under settings_lock
+    std::atomic<long> settings_gen;
+    struct fa_settings frame_settings; // video callback thread
+    long frame_settings_gen;
+    long analyzed_settings_gen; // analysis thread
+    // Set from the video callbacks, published from video_tick
+    std::atomic<long> unsupported_format; // -1 = ok, otherwise video_format enum value
+    // GPU staging resources for sync sources (video_render path).
+    // Frame k is staged into one slot while the slot staged readback_depth-1
+    // frames earlier is mapped, so the map normally finds the copy finished.
     gs_texrender_t *texrender;
-    gs_stagesurf_t *stagesurface;
+    struct readback_slot readback[READBACK_RING_MAX];
+    int readback_depth;
+    int readback_ring_size; // depth the ring was created with
+    int readback_next;
     uint32_t staged_width;
     uint32_t staged_height;
+    uint64_t readback_maps;
+    uint64_t readback_stalls;
+    uint64_t readback_reported_stalls;
+    uint64_t readback_last_report;
+    // Optional analysis worker. The video callback copies the ROI rows into
+    // a lock-free single-producer/single-consumer set of job slots and the
+    // worker runs analyze_frame() on them in sequence order. When no slot is
+    // free the producer drops the oldest queued frame. The worker is
+    // started/stopped only by the producer thread.
+    bool use_worker;        // setting
+    bool worker_running;
+    std::thread worker_thread;
+    std::mutex worker_lock;
+    std::condition_variable worker_wake;
+    int worker_posts;  // frames queued since the worker last woke, under worker_lock
+    bool worker_stop;  // under worker_lock
+    struct analysis_job jobs[WORKER_QUEUE_SLOTS];
+    std::atomic<long> job_state[WORKER_QUEUE_SLOTS];
+    unsigned long job_seq;  // producer-owned sequence counter
+    uint64_t frames_queued;
+    uint64_t frames_dropped;
+    uint64_t frames_analyzed; // written by the worker
     // Debug: log format once
     int last_logged_format;
-    // Tearing history per-frame (aligned with frametime_history)
-    bool tearing_per_frame[FRAMETIME_HISTORY];
-    double fps_per_frame[FRAMETIME_HISTORY];
-    double smoothed_frametime[FRAMETIME_HISTORY];
-    double ema_frametime; // EMA state for frametime smoothing
 };
 
-// --- Utility functions ---
+// --- Shared analysis logic ---
 
-static void ensure_luma_buffer(struct fps_analyzer_filter *filter, size_t needed) {
-    if (filter->luma_buffer_size >= needed)
-        return;
-    if (filter->luma_buffer) bfree(filter->luma_buffer);
-    filter->luma_buffer = (uint8_t *)bzalloc(needed);
-    filter->luma_buffer_size = needed;
+// Map the OBS frame format to the plane the analysis reads
+static fa_pixel_format_t analysis_format(enum video_format format)
+{
+    switch (format) {
+    case VIDEO_FORMAT_NV12:
+    case VIDEO_FORMAT_I420:
+    case VIDEO_FORMAT_I444:
+    case VIDEO_FORMAT_I422:
+        // Y plane in data[0] with linesize[0] stride
+        return FA_FORMAT_Y8;
+    case VIDEO_FORMAT_YUY2:
+        return FA_FORMAT_YUY2;
+    case VIDEO_FORMAT_UYVY:
+        return FA_FORMAT_UYVY;
+    case VIDEO_FORMAT_BGRA:
+        return FA_FORMAT_BGRA;
+    case VIDEO_FORMAT_RGBA:
+        return FA_FORMAT_RGBA;
+    default:
+        return FA_FORMAT_NONE;
+    }
 }
 
-// Funkcja do liczenia różniących się bajtów
-static size_t count_diff_bytes(const uint8_t *a, const uint8_t *b, size_t size) {
-    size_t diff = 0;
-    for (size_t i = 0; i < size; ++i) {
-        if (a[i] != b[i]) ++diff;
+// Open/close the event log after a settings change. Runs on the analysis
+// thread, so the file is created there and appends need no locking.
+static void apply_event_log_settings(struct fps_analyzer_filter *filter, uint64_t timestamp)
+{
+    if (filter->event_log_gen.load() == filter->event_log_applied_gen)
+        return;
+    bool enable;
+    char path[sizeof(filter->event_log_path)];
+    {
+        std::lock_guard<std::mutex> guard(filter->event_log_lock);
+        filter->event_log_applied_gen = filter->event_log_gen.load();
+        enable = filter->enable_event_log;
+        memcpy(path, filter->event_log_path, sizeof(path));
     }
-    return diff;
+
+    fa_event_log_close(filter->event_log);
+    filter->event_log = NULL;
+    if (!enable)
+        return;
+    filter->event_log = fa_event_log_create(path, FA_EVENT_LOG_DEFAULT_CAPACITY, timestamp);
+    if (filter->event_log)
+        blog(LOG_INFO, "[FPS Analyzer] Event log: %s", path);
+    else
+        blog(LOG_WARNING, "[FPS Analyzer] Cannot create event log %s", path);
 }
 
-// Funkcja do inicjalizacji buforów dla poprzednich linii
-static void init_prev_lines_buffers(struct fps_analyzer_filter *filter, int roi_width) {
-    for (int i = 0; i < 3; ++i) {
-        if (filter->prev_lines[i]) bfree(filter->prev_lines[i]);
-        filter->prev_lines[i] = (uint8_t*)bzalloc(roi_width);
+static void analyze_frame(struct fps_analyzer_filter *filter, fa_pixel_format_t format,
+                          const uint8_t *data, uint32_t linesize,
+                          uint32_t width, uint32_t height, uint64_t timestamp,
+                          const struct fa_settings *settings, long settings_gen)
+{
+    apply_event_log_settings(filter, timestamp);
+    if (settings_gen != filter->analyzed_settings_gen) {
+        // Applied by the push below, before this frame is analyzed
+        fa_update(filter->analyzer, settings);
+        filter->analyzed_settings_gen = settings_gen;
     }
-    filter->prev_lines_size = roi_width;
+
+    struct fa_frame_result result;
+    if (fa_push_frame(filter->analyzer, format, data, linesize, width, height, timestamp, &result) &&
+        result.unique && filter->event_log)
+        fa_event_log_append(filter->event_log, timestamp, &result);
 }
 
-// Funkcja do inicjalizacji bufora poprzedniej klatki
-static void init_prev_frame_buffer(struct fps_analyzer_filter *filter, size_t roi_size, const uint8_t *roi_ptr) {
-    if (filter->prev_frame) bfree(filter->prev_frame);
-    filter->prev_frame = (uint8_t*)bzalloc(roi_size);
-    filter->prev_frame_size = roi_size;
-    memcpy(filter->prev_frame, roi_ptr, roi_size);
+// --- Analysis worker ---
+
+static inline long job_state_pack(unsigned long seq, int state)
+{
+    return (long)(((seq & JOB_SEQ_MASK) << 2) | (unsigned long)state);
 }
 
-// --- Luma conversion helpers (ITU-R BT.601) ---
+static inline int job_state_tag(long v)
+{
+    return (int)((unsigned long)v & 3);
+}
 
-static void bgra_to_luma(const uint8_t *bgra, uint32_t linesize,
-                          uint8_t *luma, uint32_t width, uint32_t height) {
-    for (uint32_t y = 0; y < height; ++y) {
-        const uint8_t *row = bgra + y * linesize;
-        for (uint32_t x = 0; x < width; ++x) {
-            uint8_t b = row[x * 4 + 0];
-            uint8_t g = row[x * 4 + 1];
-            uint8_t r = row[x * 4 + 2];
-            luma[y * width + x] = (uint8_t)((r * 66 + g * 129 + b * 25 + 128) >> 8) + 16;
-        }
-    }
+static inline unsigned long job_state_seq(long v)
+{
+    return ((unsigned long)v >> 2) & JOB_SEQ_MASK;
 }
 
-static void rgba_to_luma(const uint8_t *rgba, uint32_t linesize,
-                          uint8_t *luma, uint32_t width, uint32_t height) {
-    for (uint32_t y = 0; y < height; ++y) {
-        const uint8_t *row = rgba + y * linesize;
-        for (uint32_t x = 0; x < width; ++x) {
-            uint8_t r = row[x * 4 + 0];
-            uint8_t g = row[x * 4 + 1];
-            uint8_t b = row[x * 4 + 2];
-            luma[y * width + x] = (uint8_t)((r * 66 + g * 129 + b * 25 + 128) >> 8) + 16;
+// Oldest slot in the given state (sequence compared modulo wrap-around), -1 if none
+static int find_oldest_job(struct fps_analyzer_filter *filter, int state, long *value)
+{
+    int best = -1;
+    unsigned long best_seq = 0;
+    for (int i = 0; i < WORKER_QUEUE_SLOTS; ++i) {
+        long v = filter->job_state[i].load();
+        if (job_state_tag(v) != state)
+            continue;
+        unsigned long seq = job_state_seq(v);
+        if (best < 0 || ((best_seq - seq) & JOB_SEQ_MASK) < (JOB_SEQ_MASK / 2)) {
+            best = i;
+            best_seq = seq;
+            *value = v;
         }
     }
+    return best;
 }
 
-// --- Shared analysis logic ---
-
-// Wspólna logika analizy klatek — porównanie z poprzednią klatką, rolling window, frametime
-static void analyze_luma_frame(struct fps_analyzer_filter *filter,
-                               const uint8_t *luma_ptr, size_t luma_size) {
-    int is_unique = 0;
-    if (!filter->prev_frame || filter->prev_frame_size != luma_size) {
-        init_prev_frame_buffer(filter, luma_size, luma_ptr);
-        is_unique = 1;
-    } else {
-        size_t diff = count_diff_bytes(luma_ptr, filter->prev_frame, luma_size);
-        double percent = (luma_size > 0) ? (100.0 * diff / luma_size) : 0.0;
-        if (percent >= filter->sensitivity) {
-            is_unique = 1;
-        }
-        memcpy(filter->prev_frame, luma_ptr, luma_size);
-    }
-    if (is_unique) {
-        uint64_t now = os_gettime_ns();
-        int idx = (filter->rolling_start + filter->rolling_count) % ROLLING_MAX;
-        filter->rolling_times[idx] = now;
-        if (filter->rolling_count < ROLLING_MAX) {
-            filter->rolling_count++;
-        } else {
-            filter->rolling_start = (filter->rolling_start + 1) % ROLLING_MAX;
-        }
-        while (filter->rolling_count > 0 &&
-               now - filter->rolling_times[filter->rolling_start] > 1000000000ULL) {
-            filter->rolling_start = (filter->rolling_start + 1) % ROLLING_MAX;
-            filter->rolling_count--;
+static void analysis_worker_thread(struct fps_analyzer_filter *filter)
+{
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> guard(filter->worker_lock);
+            filter->worker_wake.wait(guard, [filter] { return filter->worker_stop || filter->worker_posts > 0; });
+            if (filter->worker_stop)
+                break;
+            filter->worker_posts--;
         }
-        if (filter->last_unique_frame_time != 0) {
-            double ft = (now - filter->last_unique_frame_time) / 1000000.0;
-            filter->frametime_history[filter->frametime_pos] = ft;
-            filter->tearing_per_frame[filter->frametime_pos] = filter->tearing_detected;
-
-            // Smoothed frametime: EMA (exponential moving average)
-            // alpha=0.15 — responsive enough to show stutters, smooth enough to reduce noise
-            {
-                const double alpha = 0.15;
-                if (filter->ema_frametime <= 0.0)
-                    filter->ema_frametime = ft; // init to first value
-                else
-                    filter->ema_frametime = filter->ema_frametime * (1.0 - alpha) + ft * alpha;
-                filter->smoothed_frametime[filter->frametime_pos] = filter->ema_frametime;
-            }
 
-            // Compute smoothed FPS for this point: average frametime over ~1s window
-            // Window size based on instantaneous FPS estimate
-            int inst_fps = (ft > 0.0) ? (int)round(1000.0 / ft) : 30;
-            if (inst_fps < 10) inst_fps = 10;
-            if (inst_fps > 120) inst_fps = 120;
-            int window = inst_fps;
-            if (window > filter->frametime_count) window = filter->frametime_count;
-            if (window < 1) window = 1;
-            double sum = 0.0;
-            for (int w = 0; w < window; w++) {
-                int idx = (filter->frametime_pos - w + FRAMETIME_HISTORY) % FRAMETIME_HISTORY;
-                sum += filter->frametime_history[idx];
-            }
-            double avg_ft = sum / window;
-            filter->fps_per_frame[filter->frametime_pos] = (avg_ft > 0.0) ? round(1000.0 / avg_ft) : 0.0;
-
-            filter->frametime_pos = (filter->frametime_pos + 1) % FRAMETIME_HISTORY;
-            if (filter->frametime_count < FRAMETIME_HISTORY)
-                filter->frametime_count++;
+        // Claim the oldest queued job. The producer may drop it at the same
+        // time, in which case the CAS fails and we look again.
+        for (;;) {
+            long v;
+            int i = find_oldest_job(filter, JOB_QUEUED, &v);
+            if (i < 0)
+                break;
+            if (!filter->job_state[i].compare_exchange_strong(v, job_state_pack(job_state_seq(v), JOB_BUSY)))
+                continue;
+
+            struct analysis_job *job = &filter->jobs[i];
+            analyze_frame(filter, job->format, job->data, job->linesize,
+                          job->width, job->height, job->timestamp, &job->settings, job->settings_gen);
+            filter->frames_analyzed++;
+            filter->job_state[i].store(job_state_pack(0, JOB_FREE));
+            break;
         }
-        filter->last_unique_frame_time = now;
     }
 }
 
-// --- Tearing detection ---
+// Copy the rows analyze_frame() will read into a free job slot.
+// Only called from the video callback thread.
+static void enqueue_analysis_job(struct fps_analyzer_filter *filter, fa_pixel_format_t format,
+                                 const uint8_t *data, uint32_t linesize,
+                                 uint32_t width, uint32_t height, uint64_t timestamp)
+{
+    // At most one slot is busy in the worker, so there is always a free slot
+    // or a queued one that can be dropped
+    int slot;
+    for (;;) {
+        long v;
+        slot = find_oldest_job(filter, JOB_FREE, &v);
+        if (slot >= 0) {
+            // Only the producer moves slots out of JOB_FREE
+            filter->job_state[slot].store(job_state_pack(0, JOB_WRITING));
+            break;
+        }
+        slot = find_oldest_job(filter, JOB_QUEUED, &v);
+        if (slot >= 0 && filter->job_state[slot].compare_exchange_strong(v, job_state_pack(0, JOB_WRITING))) {
+            filter->frames_dropped++;
+            break;
+        }
+    }
 
-// Core tearing detection — takes 3 concatenated luma lines (top, mid, bottom), each roi_width bytes
-static bool detect_tearing_core(struct fps_analyzer_filter *filter,
-                                const uint8_t *lines_luma, int roi_width) {
-    if (!filter->enable_tearing_detection) return false;
+    struct analysis_job *job = &filter->jobs[slot];
+    const uint32_t bpp = fa_pixel_format_bpp(format);
+    const uint32_t row_bytes = width * bpp;
 
-    if (!filter->prev_lines[0] || filter->prev_lines_size != (size_t)roi_width) {
-        init_prev_lines_buffers(filter, roi_width);
-        memcpy(filter->prev_lines[0], lines_luma, roi_width);
-        memcpy(filter->prev_lines[1], lines_luma + roi_width, roi_width);
-        memcpy(filter->prev_lines[2], lines_luma + 2 * roi_width, roi_width);
-        return false;
+    uint32_t line_ys[3] = {0, height / 2, height - 1};
+    uint32_t rows = height;
+    const uint32_t *ys = NULL;
+    if (filter->frame_settings.analyze_method == ANALYZE_LAST_LINE && height > 0) {
+        rows = filter->frame_settings.enable_tearing_detection ? 3 : 1;
+        ys = line_ys + (3 - rows);
     }
 
-    // Porównaj 3 linie osobno z progiem czułości
-    double change_percent[3] = {0.0, 0.0, 0.0};
-    for (int i = 0; i < 3; ++i) {
-        size_t diff = count_diff_bytes(lines_luma + i * roi_width, filter->prev_lines[i], roi_width);
-        change_percent[i] = (roi_width > 0) ? (100.0 * diff / roi_width) : 0.0;
+    size_t needed = (size_t)row_bytes * rows;
+    if (job->capacity < needed) {
+        bfree(job->data);
+        job->data = (uint8_t *)bmalloc(needed);
+        job->capacity = needed;
     }
-
-    // Zapisz aktualne linie
-    memcpy(filter->prev_lines[0], lines_luma, roi_width);
-    memcpy(filter->prev_lines[1], lines_luma + roi_width, roi_width);
-    memcpy(filter->prev_lines[2], lines_luma + 2 * roi_width, roi_width);
-
-    // Ulepszona logika wykrywania tearingu
-    bool significant_change[3] = {false, false, false};
-    for (int i = 0; i < 3; ++i) {
-        significant_change[i] = (change_percent[i] >= filter->tearing_sensitivity);
+    for (uint32_t r = 0; r < rows; ++r) {
+        uint32_t y = ys ? ys[r] : r;
+        memcpy(job->data + (size_t)r * row_bytes, data + (size_t)y * linesize, row_bytes);
     }
-
-    // Wykryj tearing: jeśli nie wszystkie linie się zmieniły jednocześnie
-    bool all_changed = significant_change[0] && significant_change[1] && significant_change[2];
-    bool none_changed = !significant_change[0] && !significant_change[1] && !significant_change[2];
-    bool tearing = !(all_changed || none_changed);
-
-    // Dodaj do historii tearingu
-    filter->tearing_history[filter->tearing_history_pos] = tearing ? 1 : 0;
-    filter->tearing_history_pos = (filter->tearing_history_pos + 1) % 5;
-
-    // Sprawdź czy w ostatnich 5 klatkach było więcej niż 2 wykrycia tearingu
-    int recent_tears = 0;
-    for (int i = 0; i < 5; ++i) {
-        recent_tears += filter->tearing_history[i];
+    job->format = format;
+    job->width = width;
+    job->height = rows;
+    job->linesize = row_bytes;
+    job->timestamp = timestamp;
+    job->settings = filter->frame_settings;
+    job->settings_gen = filter->frame_settings_gen;
+
+    filter->job_state[slot].store(job_state_pack(filter->job_seq++, JOB_QUEUED));
+    filter->frames_queued++;
+    {
+        std::lock_guard<std::mutex> guard(filter->worker_lock);
+        filter->worker_posts++;
     }
-    return (recent_tears >= 2);
+    filter->worker_wake.notify_one();
 }
 
-// Extract 3 tearing lines from async frame and run detection
-static bool detect_tearing_async(struct fps_analyzer_filter *filter,
-                                 struct obs_source_frame *frame) {
-    if (!filter->enable_tearing_detection) return false;
-
-    const int roi_width = (int)frame->width;
-    if (roi_width > 4096) return false;
-
-    uint8_t lines_luma[3 * 4096];
-    int line_ys[3] = {0, (int)frame->height / 2, (int)frame->height - 1};
-
-    switch (frame->format) {
-    case VIDEO_FORMAT_NV12:
-    case VIDEO_FORMAT_I420:
-    case VIDEO_FORMAT_I444:
-    case VIDEO_FORMAT_I422:
-        for (int i = 0; i < 3; ++i) {
-            int y = line_ys[i];
-            memcpy(lines_luma + i * roi_width,
-                   frame->data[0] + y * frame->linesize[0], roi_width);
-        }
-        break;
-    case VIDEO_FORMAT_YUY2:
-        for (int i = 0; i < 3; ++i) {
-            int y = line_ys[i];
-            uint8_t *src = frame->data[0] + y * frame->linesize[0];
-            for (int x = 0; x < roi_width; ++x) {
-                lines_luma[i * roi_width + x] = src[x * 2];
-            }
-        }
-        break;
-    case VIDEO_FORMAT_UYVY:
-        for (int i = 0; i < 3; ++i) {
-            int y = line_ys[i];
-            uint8_t *src = frame->data[0] + y * frame->linesize[0];
-            for (int x = 0; x < roi_width; ++x) {
-                lines_luma[i * roi_width + x] = src[x * 2 + 1];
-            }
-        }
-        break;
-    case VIDEO_FORMAT_BGRA:
-        for (int i = 0; i < 3; ++i) {
-            int y = line_ys[i];
-            const uint8_t *row = frame->data[0] + y * frame->linesize[0];
-            for (int x = 0; x < roi_width; ++x) {
-                uint8_t b = row[x * 4 + 0];
-                uint8_t g = row[x * 4 + 1];
-                uint8_t r = row[x * 4 + 2];
-                lines_luma[i * roi_width + x] = (uint8_t)((r * 66 + g * 129 + b * 25 + 128) >> 8) + 16;
-            }
-        }
-        break;
-    case VIDEO_FORMAT_RGBA:
-        for (int i = 0; i < 3; ++i) {
-            int y = line_ys[i];
-            const uint8_t *row = frame->data[0] + y * frame->linesize[0];
-            for (int x = 0; x < roi_width; ++x) {
-                uint8_t r = row[x * 4 + 0];
-                uint8_t g = row[x * 4 + 1];
-                uint8_t b = row[x * 4 + 2];
-                lines_luma[i * roi_width + x] = (uint8_t)((r * 66 + g * 129 + b * 25 + 128) >> 8) + 16;
-            }
-        }
-        break;
-    default:
-        return false;
+static void start_analysis_worker(struct fps_analyzer_filter *filter)
+{
+    filter->worker_stop = false;
+    filter->worker_posts = 0;
+    for (int i = 0; i < WORKER_QUEUE_SLOTS; ++i)
+        filter->job_state[i].store(job_state_pack(0, JOB_FREE));
+    try {
+        filter->worker_thread = std::thread(analysis_worker_thread, filter);
+    } catch (...) {
+        return;
     }
+    filter->worker_running = true;
+}
 
-    return detect_tearing_core(filter, lines_luma, roi_width);
+// Joins the worker; frames still queued are discarded
+static void stop_analysis_worker(struct fps_analyzer_filter *filter)
+{
+    if (!filter->worker_running)
+        return;
+    {
+        std::lock_guard<std::mutex> guard(filter->worker_lock);
+        filter->worker_stop = true;
+    }
+    filter->worker_wake.notify_one();
+    filter->worker_thread.join();
+    filter->worker_running = false;
+
+    int pending = 0;
+    for (int i = 0; i < WORKER_QUEUE_SLOTS; ++i) {
+        if (job_state_tag(filter->job_state[i].load()) == JOB_QUEUED)
+            pending++;
+    }
+    blog(LOG_INFO, "[FPS Analyzer] Analysis worker stopped: %llu frames queued, %llu dropped, %llu analyzed, %d discarded",
+         (unsigned long long)filter->frames_queued, (unsigned long long)filter->frames_dropped,
+         (unsigned long long)filter->frames_analyzed, pending);
 }
 
-// Extract 3 tearing lines from BGRA staging data and run detection
-static bool detect_tearing_bgra(struct fps_analyzer_filter *filter,
-                                const uint8_t *bgra, uint32_t linesize,
-                                uint32_t width, uint32_t height) {
-    if (!filter->enable_tearing_detection) return false;
-    if (width > 4096) return false;
+// Entry point for both video paths: analyze inline or hand off to the worker.
+// Returns false for unsupported formats.
+static bool submit_frame(struct fps_analyzer_filter *filter, enum video_format format,
+                         const uint8_t *data, uint32_t linesize,
+                         uint32_t width, uint32_t height, uint64_t timestamp)
+{
+    fa_pixel_format_t fmt = analysis_format(format);
+    if (fmt == FA_FORMAT_NONE)
+        return false;
 
-    uint8_t lines_luma[3 * 4096];
-    int line_ys[3] = {0, (int)height / 2, (int)height - 1};
+    if (filter->settings_gen.load() != filter->frame_settings_gen) {
+        std::lock_guard<std::mutex> guard(filter->settings_lock);
+        filter->frame_settings_gen = filter->settings_gen.load();
+        filter->frame_settings = filter->settings;
+    }
 
-    for (int i = 0; i < 3; ++i) {
-        const uint8_t *row = bgra + line_ys[i] * linesize;
-        for (uint32_t x = 0; x < width; ++x) {
-            uint8_t b = row[x * 4 + 0];
-            uint8_t g = row[x * 4 + 1];
-            uint8_t r = row[x * 4 + 2];
-            lines_luma[i * width + x] = (uint8_t)((r * 66 + g * 129 + b * 25 + 128) >> 8) + 16;
-        }
+    // Apply the setting here so only this thread ever starts/stops the worker
+    // and inline analysis never overlaps with a running worker
+    if (filter->use_worker != filter->worker_running) {
+        if (filter->use_worker)
+            start_analysis_worker(filter);
+        else
+            stop_analysis_worker(filter);
     }
 
-    return detect_tearing_core(filter, lines_luma, (int)width);
+    if (filter->worker_running)
+        enqueue_analysis_job(filter, fmt, data, linesize, width, height, timestamp);
+    else
+        analyze_frame(filter, fmt, data, linesize, width, height, timestamp, &filter->frame_settings,
+                      filter->frame_settings_gen);
+    return true;
 }
 
 // --- Async source path (filter_video) ---
@@ -369,108 +626,81 @@ static struct obs_source_frame *fps_analyzer_filter_video(void *data,
         filter->last_logged_format = (int)frame->format;
     }
 
-    const uint32_t width = frame->width;
-    const uint32_t height = frame->height;
-    int roi_line, roi_lines;
-
-    if (filter->analyze_method == ANALYZE_DIFF) {
-        roi_line = 0;
-        roi_lines = height;
-    } else {
-        roi_line = height - 1;
-        roi_lines = 1;
+    if (!submit_frame(filter, frame->format, frame->data[0], frame->linesize[0],
+                      frame->width, frame->height, os_gettime_ns())) {
+        filter->unsupported_format.store((long)frame->format);
+        return frame;
     }
+    filter->unsupported_format.store(-1);
 
-    size_t luma_size = (size_t)width * roi_lines;
-    // Allocate enough for full frame (needed for tearing detection even in LAST_LINE mode)
-    ensure_luma_buffer(filter, (size_t)width * height);
-    uint8_t *luma = filter->luma_buffer;
-    bool format_ok = true;
+    return frame;
+}
 
-    switch (frame->format) {
-    case VIDEO_FORMAT_NV12:
-    case VIDEO_FORMAT_I420:
-    case VIDEO_FORMAT_I444:
-    case VIDEO_FORMAT_I422:
-        // Y plane in data[0] with linesize[0] stride
-        if (filter->analyze_method == ANALYZE_DIFF) {
-            for (uint32_t y = 0; y < height; ++y) {
-                memcpy(luma + y * width,
-                       frame->data[0] + y * frame->linesize[0], width);
-            }
-        } else {
-            memcpy(luma, frame->data[0] + roi_line * frame->linesize[0], width);
-        }
-        break;
-    case VIDEO_FORMAT_YUY2:
-        // Y at even byte positions: src[x*2]
-        if (filter->analyze_method == ANALYZE_DIFF) {
-            for (uint32_t y = 0; y < height; ++y) {
-                uint8_t *src = frame->data[0] + y * frame->linesize[0];
-                for (uint32_t x = 0; x < width; ++x) {
-                    luma[y * width + x] = src[x * 2];
-                }
-            }
-        } else {
-            uint8_t *src = frame->data[0] + roi_line * frame->linesize[0];
-            for (uint32_t x = 0; x < width; ++x) {
-                luma[x] = src[x * 2];
-            }
-        }
-        break;
-    case VIDEO_FORMAT_UYVY:
-        // Y at odd byte positions: src[x*2+1]
-        if (filter->analyze_method == ANALYZE_DIFF) {
-            for (uint32_t y = 0; y < height; ++y) {
-                uint8_t *src = frame->data[0] + y * frame->linesize[0];
-                for (uint32_t x = 0; x < width; ++x) {
-                    luma[y * width + x] = src[x * 2 + 1];
-                }
-            }
-        } else {
-            uint8_t *src = frame->data[0] + roi_line * frame->linesize[0];
-            for (uint32_t x = 0; x < width; ++x) {
-                luma[x] = src[x * 2 + 1];
-            }
-        }
-        break;
-    case VIDEO_FORMAT_BGRA:
-        if (filter->analyze_method == ANALYZE_DIFF) {
-            bgra_to_luma(frame->data[0], frame->linesize[0], luma, width, height);
-        } else {
-            bgra_to_luma(frame->data[0] + roi_line * frame->linesize[0],
-                         frame->linesize[0], luma, width, 1);
-        }
-        break;
-    case VIDEO_FORMAT_RGBA:
-        if (filter->analyze_method == ANALYZE_DIFF) {
-            rgba_to_luma(frame->data[0], frame->linesize[0], luma, width, height);
-        } else {
-            rgba_to_luma(frame->data[0] + roi_line * frame->linesize[0],
-                         frame->linesize[0], luma, width, 1);
-        }
-        break;
-    default:
-        format_ok = false;
-        break;
-    }
+// --- Sync source path (video_render) ---
 
-    if (!format_ok) {
-        g_fps_shared.unsupported_format = (int)frame->format;
-        return frame;
+static void destroy_readback_ring(struct fps_analyzer_filter *filter)
+{
+    for (int i = 0; i < READBACK_RING_MAX; ++i) {
+        if (filter->readback[i].surface)
+            gs_stagesurface_destroy(filter->readback[i].surface);
+        filter->readback[i].surface = NULL;
+        filter->readback[i].pending = false;
     }
-    g_fps_shared.unsupported_format = -1;
+    filter->readback_ring_size = 0;
+    filter->readback_next = 0;
+}
+
+// (Re)create the staging surfaces when the size or ring depth changes
+static void ensure_readback_ring(struct fps_analyzer_filter *filter,
+                                 uint32_t width, uint32_t height)
+{
+    if (filter->readback_ring_size == filter->readback_depth &&
+        filter->staged_width == width && filter->staged_height == height)
+        return;
+    destroy_readback_ring(filter);
+    for (int i = 0; i < filter->readback_depth; ++i)
+        filter->readback[i].surface = gs_stagesurface_create(width, height, GS_BGRA);
+    filter->readback_ring_size = filter->readback_depth;
+    filter->staged_width = width;
+    filter->staged_height = height;
+}
 
-    // Wykrywanie tearingu (niezależne od metody analizy)
-    filter->tearing_detected = detect_tearing_async(filter, frame);
+// Map the oldest staged frame and analyze it with its original render time
+static void map_readback_slot(struct fps_analyzer_filter *filter, struct readback_slot *slot)
+{
+    if (!slot->pending || !slot->surface)
+        return;
+    slot->pending = false;
 
-    // Analiza klatki
-    analyze_luma_frame(filter, luma, luma_size);
+    uint8_t *video_data;
+    uint32_t video_linesize;
+    uint64_t map_start = os_gettime_ns();
+    bool mapped = gs_stagesurface_map(slot->surface, &video_data, &video_linesize);
+    uint64_t map_end = os_gettime_ns();
+    if (!mapped)
+        return;
 
-    return frame;
-}
+    filter->readback_maps++;
+    if (map_end - map_start > READBACK_STALL_NS)
+        filter->readback_stalls++;
 
-// --- Sync source path (video_render) ---
+    submit_frame(filter, VIDEO_FORMAT_BGRA, video_data, video_linesize,
+                 filter->staged_width, filter->staged_height, slot->render_time);
+    filter->unsupported_format.store(-1);
+
+    gs_stagesurface_unmap(slot->surface);
+
+    // Periodic stall report (only when new stalls happened)
+    if (map_end - filter->readback_last_report > 30000000000ULL) {
+        if (filter->readback_stalls != filter->readback_reported_stalls) {
+            blog(LOG_INFO, "[FPS Analyzer] Readback (depth %d): %llu of %llu maps blocked on the GPU",
+                 filter->readback_ring_size, (unsigned long long)filter->readback_stalls,
+                 (unsigned long long)filter->readback_maps);
+            filter->readback_reported_stalls = filter->readback_stalls;
+        }
+        filter->readback_last_report = map_end;
+    }
+}
 
 static void fps_analyzer_video_render(void *data, gs_effect_t *effect)
 {
@@ -499,18 +729,13 @@ static void fps_analyzer_video_render(void *data, gs_effect_t *effect)
         return;
     }
 
+    uint64_t render_time = os_gettime_ns();
+
     // Lazy-init GPU resources
     if (!filter->texrender) {
         filter->texrender = gs_texrender_create(GS_BGRA, GS_ZS_NONE);
     }
-    if (!filter->stagesurface ||
-        filter->staged_width != width || filter->staged_height != height) {
-        if (filter->stagesurface)
-            gs_stagesurface_destroy(filter->stagesurface);
-        filter->stagesurface = gs_stagesurface_create(width, height, GS_BGRA);
-        filter->staged_width = width;
-        filter->staged_height = height;
-    }
+    ensure_readback_ring(filter, width, height);
 
     // Render parent source into texrender
     gs_texrender_reset(filter->texrender);
@@ -532,34 +757,17 @@ static void fps_analyzer_video_render(void *data, gs_effect_t *effect)
         return;
     }
 
-    // Stage texture to CPU for analysis
-    gs_stage_texture(filter->stagesurface, tex);
-    uint8_t *video_data;
-    uint32_t video_linesize;
-    if (gs_stagesurface_map(filter->stagesurface, &video_data, &video_linesize)) {
-        // Tearing detection from BGRA staging data
-        filter->tearing_detected = detect_tearing_bgra(
-            filter, video_data, video_linesize, width, height);
-
-        // Extract luma for analysis
-        size_t luma_size;
-        if (filter->analyze_method == ANALYZE_DIFF) {
-            luma_size = (size_t)width * height;
-            ensure_luma_buffer(filter, luma_size);
-            bgra_to_luma(video_data, video_linesize,
-                         filter->luma_buffer, width, height);
-        } else {
-            luma_size = width;
-            ensure_luma_buffer(filter, luma_size);
-            bgra_to_luma(video_data + (height - 1) * video_linesize,
-                         video_linesize, filter->luma_buffer, width, 1);
-        }
-
-        analyze_luma_frame(filter, filter->luma_buffer, luma_size);
-        g_fps_shared.unsupported_format = -1;
-
-        gs_stagesurface_unmap(filter->stagesurface);
+    // Stage this frame, then map the one staged depth-1 frames ago
+    // (depth 1 maps the frame just staged, i.e. a synchronous readback)
+    int depth = filter->readback_ring_size;
+    struct readback_slot *slot = &filter->readback[filter->readback_next];
+    if (slot->surface) {
+        gs_stage_texture(slot->surface, tex);
+        slot->render_time = render_time;
+        slot->pending = true;
     }
+    filter->readback_next = (filter->readback_next + 1) % depth;
+    map_readback_slot(filter, &filter->readback[filter->readback_next]);
 
     // Draw the rendered texture to output (passthrough)
     gs_effect_t *def_effect = obs_get_base_effect(OBS_EFFECT_DEFAULT);
@@ -572,6 +780,21 @@ static void fps_analyzer_video_render(void *data, gs_effect_t *effect)
 
 // --- Output (tick) ---
 
+// Channel name "<source> / <filter>", refreshed when either is renamed
+static void update_channel_name(struct fps_analyzer_filter *filter)
+{
+    obs_source_t *parent = obs_filter_get_parent(filter->context);
+    if (!parent)
+        return;
+    char name[FPS_SHARED_NAME_MAX];
+    snprintf(name, sizeof(name), "%s / %s", obs_source_get_name(parent),
+             obs_source_get_name(filter->context));
+    if (strcmp(name, filter->channel_name) != 0) {
+        memcpy(filter->channel_name, name, sizeof(name));
+        fps_shared_set_name(filter->channel, name);
+    }
+}
+
 static void fps_analyzer_video_tick(void *data, float seconds)
 {
     UNUSED_PARAMETER(seconds);
@@ -582,65 +805,61 @@ static void fps_analyzer_video_tick(void *data, float seconds)
         return;
     filter->last_write_time = now;
 
+    struct fa_snapshot snap;
+    fa_snapshot(filter->analyzer, &snap);
+
     // Stale data check — if no unique frame detected for >2s, reset to 0
-    if (filter->last_unique_frame_time != 0 &&
-        now - filter->last_unique_frame_time > 2000000000ULL) {
-        filter->frametime_count = 0;
-        filter->frametime_pos = 0;
-        filter->rolling_count = 0;
-        filter->rolling_start = 0;
-    }
-
-    // --- FPS from rolling window: average last ~1 second of frametimes ---
-    // Use min(frametime_count, last_fps) as window, minimum 10, maximum 120
-    int window = filter->frametime_count;
-    if (window > 120) window = 120;
-    // Dynamically shrink window to ~1 second based on previous FPS
-    if (g_fps_shared.fps > 10 && g_fps_shared.fps < window)
-        window = g_fps_shared.fps;
-    if (window < 10 && filter->frametime_count >= 10) window = 10;
-    if (window > filter->frametime_count) window = filter->frametime_count;
-
-    double avg_frametime = 0.0;
-    for (int i = 0; i < window; ++i) {
-        int idx = (filter->frametime_pos - window + i + FRAMETIME_HISTORY) % FRAMETIME_HISTORY;
-        avg_frametime += filter->frametime_history[idx];
-    }
-    if (window > 0)
-        avg_frametime /= window;
-    double fps = (avg_frametime > 0.0) ? (1000.0 / avg_frametime) : 0.0;
-    int fps_smooth = (int)round(fps);
-    double frametime_ms = avg_frametime;
-
-    // Update shared data for overlay source
-    g_fps_shared.fps = fps_smooth;
-    g_fps_shared.frametime_ms = frametime_ms;
-    g_fps_shared.tearing_detected = filter->tearing_detected;
-    g_fps_shared.last_update_ns = now;
-
-    // Linearize circular frametime buffer for graph (oldest → newest)
-    int count = filter->frametime_count;
-    if (count > FPS_GRAPH_HISTORY) count = FPS_GRAPH_HISTORY;
-    for (int i = 0; i < count; i++) {
-        int idx = (filter->frametime_pos - count + i + FRAMETIME_HISTORY) % FRAMETIME_HISTORY;
-        g_fps_shared.graph_frametimes[i] = filter->smoothed_frametime[idx];
-        g_fps_shared.graph_frametimes_raw[i] = filter->frametime_history[idx];
-        g_fps_shared.graph_fps[i] = filter->fps_per_frame[idx];
-        g_fps_shared.graph_tearing[i] = filter->tearing_per_frame[idx];
-    }
-    g_fps_shared.graph_count = count;
-
-    // Optional CSV logging
+    if (snap.last_unique_ns != 0 && now - snap.last_unique_ns > 2000000000ULL) {
+        fa_clear_history(filter->analyzer);
+        fa_snapshot(filter->analyzer, &snap);
+    }
+
+    // --- FPS from the rolling window: last 1 second of capture time ---
+    int fps_smooth = (int)round(snap.fps);
+    double frametime_ms = snap.frametime_ms;
+
+    // Update shared data for overlay sources
+    if (filter->channel) {
+        update_channel_name(filter);
+        struct fps_shared_data *shared = fps_shared_begin_write(filter->channel);
+        shared->fps = fps_smooth;
+        shared->frametime_ms = frametime_ms;
+        shared->tearing_detected = snap.tearing_detected;
+        shared->last_update_ns = now;
+        shared->unsupported_format = (int)filter->unsupported_format.load();
+        fa_frametime_stats(filter->analyzer, &shared->session_stats, &shared->recent_stats);
+        fa_pacing_stats(filter->analyzer, &shared->pacing);
+        fa_history_range(filter->analyzer, &shared->range);
+
+        // Linearized graph history (oldest → newest)
+        // Raw frametimes are not graphed: not published
+        fps_shared_reserve(shared, snap.history_length, false);
+        shared->graph_length = snap.history_length;
+        shared->graph_count = fa_copy_history(filter->analyzer, shared->graph_frametimes,
+                                              shared->graph_frametimes_raw, shared->graph_fps,
+                                              shared->graph_tearing, shared->graph_pacing,
+                                              shared->graph_length);
+        fps_shared_publish(filter->channel);
+    }
+
+    // Optional CSV logging — queued for the writer thread, no file I/O here
     if (filter->enable_csv) {
         char csv_path[512];
-        build_csv_path(filter->output_path, csv_path, sizeof(csv_path));
-        FILE *csv = fopen(csv_path, "a");
-        if (csv) {
-            time_t t = time(NULL);
-            fprintf(csv, "%lld,%d,%.2f\n", (long long)t, fps_smooth, frametime_ms);
-            fclose(csv);
+        build_output_path(filter->output_path, ".csv", csv_path, sizeof(csv_path));
+        if (filter->csv && strcmp(csv_writer_path(filter->csv), csv_path) != 0) {
+            csv_writer_destroy(filter->csv);
+            filter->csv = NULL;
         }
-        keep_last_n_lines(csv_path, FPS_CSV_HISTORY_LIMIT);
+        if (!filter->csv)
+            filter->csv = csv_writer_create(csv_path, FPS_CSV_HISTORY_LIMIT, filter->clear_csv_on_start);
+        if (filter->csv) {
+            struct timespec ts;
+            timespec_get(&ts, TIME_UTC);
+            csv_writer_push(filter->csv, ts.tv_sec + ts.tv_nsec / 1e9, fps_smooth, frametime_ms);
+        }
+    } else if (filter->csv) {
+        csv_writer_destroy(filter->csv);
+        filter->csv = NULL;
     }
 }
 
@@ -650,27 +869,49 @@ static void fps_analyzer_destroy(void *data)
 {
     struct fps_analyzer_filter *filter = (struct fps_analyzer_filter *)data;
     if (filter) {
-        g_fps_shared.active_filter_count--;
-        if (filter->prev_frame) bfree(filter->prev_frame);
-        for (int i = 0; i < 3; ++i) {
-            if (filter->prev_lines[i]) bfree(filter->prev_lines[i]);
-        }
-        if (filter->luma_buffer) bfree(filter->luma_buffer);
+        g_active_filter_count--;
+        fps_shared_unregister(filter->channel);
+        stop_analysis_worker(filter);
+        csv_writer_destroy(filter->csv);
+        fa_event_log_close(filter->event_log);
+        for (int i = 0; i < WORKER_QUEUE_SLOTS; ++i)
+            bfree(filter->jobs[i].data);
+        struct fa_frametime_stats session;
+        struct fa_pacing_stats pacing;
+        fa_frametime_stats(filter->analyzer, &session, NULL);
+        fa_pacing_stats(filter->analyzer, &pacing);
+        if (session.frames > 0)
+            blog(LOG_INFO, "[FPS Analyzer] %s: %llu frames, avg %.2f ms, p99 %.2f ms, "
+                 "1%% low %.1f fps, 0.1%% low %.1f fps, %llu off cadence, %llu stutters",
+                 filter->channel_name[0] ? filter->channel_name : "filter",
+                 (unsigned long long)session.frames, session.avg_ms, session.p99_ms,
+                 session.low_1_fps, session.low_01_fps,
+                 (unsigned long long)pacing.violations, (unsigned long long)pacing.stutters);
+        blog(LOG_INFO, "[FPS Analyzer] %s: released %zu KB of analysis state",
+             filter->channel_name[0] ? filter->channel_name : "filter",
+             fa_memory_usage(filter->analyzer) / 1024);
+        fa_destroy(filter->analyzer);
         obs_enter_graphics();
         if (filter->texrender) gs_texrender_destroy(filter->texrender);
-        if (filter->stagesurface) gs_stagesurface_destroy(filter->stagesurface);
+        destroy_readback_ring(filter);
         obs_leave_graphics();
+        if (filter->readback_maps > 0)
+            blog(LOG_INFO, "[FPS Analyzer] Readback: %llu of %llu maps blocked on the GPU",
+                 (unsigned long long)filter->readback_stalls,
+                 (unsigned long long)filter->readback_maps);
     }
-    bfree(data);
+    delete filter;
 }
 
 static void *fps_analyzer_create(obs_data_t *settings, obs_source_t *context)
 {
-    struct fps_analyzer_filter *filter = (struct fps_analyzer_filter *)bzalloc(sizeof(struct fps_analyzer_filter));
+    // Value-initialized: zeroed like bzalloc, with the thread primitives constructed
+    struct fps_analyzer_filter *filter = new (std::nothrow) fps_analyzer_filter();
+    if (!filter)
+        return NULL;
     filter->context = context;
     filter->output_path[0] = '\0';
     filter->update_interval = 1.0;
-    filter->last_unique_frame_time = 0;
     filter->clear_csv_on_start = obs_data_get_bool(settings, "clear_csv_on_start");
     const char *path = obs_data_get_string(settings, "output_path");
     if (path) {
@@ -680,37 +921,48 @@ static void *fps_analyzer_create(obs_data_t *settings, obs_source_t *context)
     filter->update_interval = obs_data_get_double(settings, "update_interval");
     if (filter->update_interval <= 0.0)
         filter->update_interval = 1.0;
-    filter->rolling_count = 0;
-    filter->rolling_start = 0;
     filter->last_write_time = 0;
-    filter->frametime_pos = 0;
-    filter->frametime_count = 0;
-    filter->analyze_method = (analyze_method_t)obs_data_get_int(settings, "analyze_method");
-    filter->sensitivity = obs_data_get_double(settings, "sensitivity");
-    filter->tearing_detected = 0;
-    filter->enable_tearing_detection = obs_data_get_bool(settings, "enable_tearing_detection");
-    filter->tearing_sensitivity = obs_data_get_double(settings, "tearing_sensitivity");
-    filter->prev_lines[0] = NULL;
-    filter->prev_lines[1] = NULL;
-    filter->prev_lines[2] = NULL;
-    filter->prev_lines_size = 0;
-    filter->tearing_history_pos = 0;
-    for (int i = 0; i < 5; ++i) {
-        filter->tearing_history[i] = 0;
-    }
-    // Dynamic luma buffer
-    filter->luma_buffer = NULL;
-    filter->luma_buffer_size = 0;
+    filter->settings.analyze_method = (analyze_method_t)obs_data_get_int(settings, "analyze_method");
+    filter->settings.sensitivity = obs_data_get_double(settings, "sensitivity");
+    filter->settings.enable_tearing_detection = obs_data_get_bool(settings, "enable_tearing_detection");
+    filter->settings.tearing_sensitivity = obs_data_get_double(settings, "tearing_sensitivity");
+    filter->settings.sample_rows = (int)obs_data_get_int(settings, "sample_rows");
+    filter->settings.sample_jitter = obs_data_get_bool(settings, "sample_jitter");
+    filter->settings.sample_column_step = (int)obs_data_get_int(settings, "sample_column_step");
+    filter->settings.analysis_threads = (int)obs_data_get_int(settings, "analysis_threads");
+    filter->settings.history_length = (int)obs_data_get_int(settings, "history_length");
+    filter->analyzer = fa_create(&filter->settings);
+    filter->frame_settings = filter->settings;
     // GPU staging (lazy init in video_render)
     filter->texrender = NULL;
-    filter->stagesurface = NULL;
+    filter->readback_depth = (int)obs_data_get_int(settings, "readback_depth");
+    if (filter->readback_depth < 1 || filter->readback_depth > READBACK_RING_MAX)
+        filter->readback_depth = 3;
+    filter->readback_ring_size = 0;
+    filter->readback_next = 0;
     filter->staged_width = 0;
     filter->staged_height = 0;
+    filter->readback_maps = 0;
+    filter->readback_stalls = 0;
+    filter->readback_reported_stalls = 0;
+    filter->readback_last_report = 0;
+    filter->use_worker = obs_data_get_bool(settings, "use_worker");
     filter->last_logged_format = -1;
-    filter->ema_frametime = 0.0;
     // CSV logging
     filter->enable_csv = obs_data_get_bool(settings, "enable_csv");
-    g_fps_shared.active_filter_count++;
+    // Event log, opened by the first analyzed frame
+    filter->enable_event_log = obs_data_get_bool(settings, "enable_event_log");
+    build_output_path(filter->output_path, ".falog", filter->event_log_path, sizeof(filter->event_log_path));
+    filter->event_log_gen = 1;
+    filter->unsupported_format = -1;
+    filter->channel = fps_shared_register();
+    if (filter->channel)
+        blog(LOG_INFO, "[FPS Analyzer] Overlay channel registered (%zu B per snapshot + graph arrays, "
+             "registry %zu KB)", sizeof(struct fps_shared_data), fps_shared_memory_used() / 1024);
+    else
+        blog(LOG_WARNING, "[FPS Analyzer] More than %d analyzers: this one is not shown by overlays",
+             FPS_SHARED_MAX_CHANNELS);
+    g_active_filter_count++;
     return filter;
 }
 
@@ -727,7 +979,12 @@ static bool analyze_method_modified(obs_properties_t *props, obs_property_t *p,
     UNUSED_PARAMETER(p);
     int method = (int)obs_data_get_int(settings, "analyze_method");
     obs_property_t *slider = obs_properties_get(props, "sensitivity");
-    obs_property_set_visible(slider, method == ANALYZE_DIFF || method == ANALYZE_LAST_LINE);
+    obs_property_set_visible(slider, method == ANALYZE_DIFF || method == ANALYZE_LAST_LINE ||
+                                     method == ANALYZE_TILED || method == ANALYZE_SAMPLED);
+    obs_property_set_visible(obs_properties_get(props, "sample_rows"), method == ANALYZE_SAMPLED);
+    obs_property_set_visible(obs_properties_get(props, "sample_jitter"), method == ANALYZE_SAMPLED);
+    obs_property_set_visible(obs_properties_get(props, "sample_column_step"), method == ANALYZE_SAMPLED);
+    obs_property_set_visible(obs_properties_get(props, "analysis_threads"), method == ANALYZE_DIFF);
     return true;
 }
 
@@ -735,11 +992,21 @@ static bool enable_csv_modified(obs_properties_t *props, obs_property_t *p, obs_
 {
     UNUSED_PARAMETER(p);
     bool csv_on = obs_data_get_bool(settings, "enable_csv");
-    obs_property_set_visible(obs_properties_get(props, "output_path"), csv_on);
+    bool log_on = obs_data_get_bool(settings, "enable_event_log");
+    obs_property_set_visible(obs_properties_get(props, "output_path"), csv_on || log_on);
     obs_property_set_visible(obs_properties_get(props, "clear_csv_on_start"), csv_on);
     return true;
 }
 
+static bool reset_session_clicked(obs_properties_t *props, obs_property_t *p, void *data)
+{
+    UNUSED_PARAMETER(props);
+    UNUSED_PARAMETER(p);
+    struct fps_analyzer_filter *filter = (struct fps_analyzer_filter *)data;
+    fa_reset_session(filter->analyzer);
+    return false;
+}
+
 static obs_properties_t *fps_analyzer_properties(void *data)
 {
     obs_properties_t *props = obs_properties_create();
@@ -749,12 +1016,27 @@ static obs_properties_t *fps_analyzer_properties(void *data)
         OBS_COMBO_TYPE_LIST, OBS_COMBO_FORMAT_INT);
     obs_property_list_add_int(method, "Last line diff (pixel analysis)", ANALYZE_LAST_LINE);
     obs_property_list_add_int(method, "Full frame diff (all lines)", ANALYZE_DIFF);
+    obs_property_list_add_int(method, "Full frame diff, tiled (stops at the threshold)", ANALYZE_TILED);
+    obs_property_list_add_int(method, "Sampled rows diff", ANALYZE_SAMPLED);
     obs_property_set_modified_callback(method, analyze_method_modified);
 
     // Sensitivity threshold
     obs_property_t *slider = obs_properties_add_float_slider(props, "sensitivity", "Sensitivity threshold (%)", 0.0, 5.0, 0.1);
-    int method_val = data ? ((struct fps_analyzer_filter*)data)->analyze_method : ANALYZE_LAST_LINE;
-    obs_property_set_visible(slider, method_val == ANALYZE_DIFF || method_val == ANALYZE_LAST_LINE);
+    int method_val = data ? ((struct fps_analyzer_filter*)data)->settings.analyze_method : ANALYZE_LAST_LINE;
+    obs_property_set_visible(slider, method_val == ANALYZE_DIFF || method_val == ANALYZE_LAST_LINE ||
+                                     method_val == ANALYZE_TILED || method_val == ANALYZE_SAMPLED);
+
+    // Sampled rows: K rows spread over the frame, optionally every n-th pixel
+    obs_property_t *rows_prop = obs_properties_add_int_slider(props, "sample_rows", "Sampled rows", 4, 256, 1);
+    obs_property_t *jitter_prop = obs_properties_add_bool(props, "sample_jitter", "Jittered row pattern");
+    obs_property_t *step_prop = obs_properties_add_int_slider(props, "sample_column_step", "Sampled column step", 1, 16, 1);
+    obs_property_set_visible(rows_prop, method_val == ANALYZE_SAMPLED);
+    obs_property_set_visible(jitter_prop, method_val == ANALYZE_SAMPLED);
+    obs_property_set_visible(step_prop, method_val == ANALYZE_SAMPLED);
+
+    // Full frame diff of 1080p and larger frames split over several threads
+    obs_property_t *threads_prop = obs_properties_add_int_slider(props, "analysis_threads", "Full frame threads (1080p and up)", 1, 16, 1);
+    obs_property_set_visible(threads_prop, method_val == ANALYZE_DIFF);
 
     // Update interval
     obs_property_t *interval = obs_properties_add_list(
@@ -766,6 +1048,24 @@ static obs_properties_t *fps_analyzer_properties(void *data)
     obs_property_list_add_float(interval, "1s", 1.0);
     obs_property_list_add_float(interval, "2s", 2.0);
 
+    // GPU readback latency (sync sources only, e.g. game/window capture)
+    obs_property_t *readback = obs_properties_add_list(
+        props, "readback_depth", "GPU readback buffering (game/window capture)",
+        OBS_COMBO_TYPE_LIST, OBS_COMBO_FORMAT_INT);
+    obs_property_list_add_int(readback, "Immediate (stalls the GPU)", 1);
+    obs_property_list_add_int(readback, "2 frames", 2);
+    obs_property_list_add_int(readback, "3 frames", 3);
+    obs_property_list_add_int(readback, "4 frames", 4);
+
+    obs_properties_add_bool(props, "use_worker", "Analyze on a separate thread");
+
+    // Unique frames graphed by overlays and behind the recent percentiles
+    obs_properties_add_int(props, "history_length", "Graph history (unique frames)",
+                           FA_HISTORY_MIN, FA_HISTORY_MAX, 60);
+
+    // Session percentiles / lows shown by the overlay
+    obs_properties_add_button(props, "reset_session", "Reset session statistics", reset_session_clicked);
+
     // Tearing detection
     obs_properties_add_bool(props, "enable_tearing_detection", "Tearing detection");
     obs_properties_add_float_slider(props, "tearing_sensitivity", "Tearing sensitivity threshold (%)", 0.1, 10.0, 0.1);
@@ -774,13 +1074,18 @@ static obs_properties_t *fps_analyzer_properties(void *data)
     obs_property_t *csv_toggle = obs_properties_add_bool(props, "enable_csv", "Enable CSV logging");
     obs_property_set_modified_callback(csv_toggle, enable_csv_modified);
 
+    // Binary per-frame log, next to the CSV with a .falog extension
+    obs_property_t *log_toggle = obs_properties_add_bool(props, "enable_event_log", "Per-frame event log (binary)");
+    obs_property_set_modified_callback(log_toggle, enable_csv_modified);
+
     obs_property_t *path_prop = obs_properties_add_path(props, "output_path", "CSV Output file",
                             OBS_PATH_FILE_SAVE, "CSV File (*.csv)", NULL);
     obs_property_t *clear_prop = obs_properties_add_bool(props, "clear_csv_on_start", "Clear CSV file on start");
 
     // Set initial CSV fields visibility
     bool csv_on = data ? ((struct fps_analyzer_filter*)data)->enable_csv : false;
-    obs_property_set_visible(path_prop, csv_on);
+    bool log_on = data ? ((struct fps_analyzer_filter*)data)->enable_event_log : false;
+    obs_property_set_visible(path_prop, csv_on || log_on);
     obs_property_set_visible(clear_prop, csv_on);
 
     return props;
@@ -798,56 +1103,57 @@ static void fps_analyzer_update(void *data, obs_data_t *settings)
     if (filter->update_interval <= 0.0)
         filter->update_interval = 1.0;
     filter->clear_csv_on_start = obs_data_get_bool(settings, "clear_csv_on_start");
-    filter->enable_tearing_detection = obs_data_get_bool(settings, "enable_tearing_detection");
-    filter->tearing_sensitivity = obs_data_get_double(settings, "tearing_sensitivity");
-    filter->analyze_method = (analyze_method_t)obs_data_get_int(settings, "analyze_method");
-    filter->sensitivity = obs_data_get_double(settings, "sensitivity");
+    // Applied by the analysis thread in analyze_frame(), with the frame the
+    // video callback picked rows for under these settings
+    {
+        std::lock_guard<std::mutex> guard(filter->settings_lock);
+        filter->settings.enable_tearing_detection = obs_data_get_bool(settings, "enable_tearing_detection");
+        filter->settings.tearing_sensitivity = obs_data_get_double(settings, "tearing_sensitivity");
+        filter->settings.analyze_method = (analyze_method_t)obs_data_get_int(settings, "analyze_method");
+        filter->settings.sensitivity = obs_data_get_double(settings, "sensitivity");
+        filter->settings.sample_rows = (int)obs_data_get_int(settings, "sample_rows");
+        filter->settings.sample_jitter = obs_data_get_bool(settings, "sample_jitter");
+        filter->settings.sample_column_step = (int)obs_data_get_int(settings, "sample_column_step");
+        filter->settings.analysis_threads = (int)obs_data_get_int(settings, "analysis_threads");
+        filter->settings.history_length = (int)obs_data_get_int(settings, "history_length");
+        filter->settings_gen++;
+    }
     filter->enable_csv = obs_data_get_bool(settings, "enable_csv");
+    // Applied by the analysis thread in apply_event_log_settings()
+    char log_path[512];
+    build_output_path(filter->output_path, ".falog", log_path, sizeof(log_path));
+    bool log_on = obs_data_get_bool(settings, "enable_event_log");
+    {
+        std::lock_guard<std::mutex> guard(filter->event_log_lock);
+        if (log_on != filter->enable_event_log || strcmp(log_path, filter->event_log_path) != 0) {
+            filter->enable_event_log = log_on;
+            memcpy(filter->event_log_path, log_path, sizeof(log_path));
+            filter->event_log_gen++;
+        }
+    }
+    // Applied by the video callback thread in submit_frame()
+    filter->use_worker = obs_data_get_bool(settings, "use_worker");
+    // Applied on the graphics thread by ensure_readback_ring()
+    filter->readback_depth = (int)obs_data_get_int(settings, "readback_depth");
+    if (filter->readback_depth < 1 || filter->readback_depth > READBACK_RING_MAX)
+        filter->readback_depth = 3;
 }
 
 // --- File helpers ---
 
-// Funkcja do budowania ścieżki pliku CSV
-static void build_csv_path(const char *output_path, char *csv_path, size_t csv_path_size) {
+// Funkcja do budowania ścieżki pliku wyjściowego (ext: ".csv", ".falog")
+static void build_output_path(const char *output_path, const char *ext, char *out_path, size_t out_path_size) {
     if (output_path[0]) {
-        strncpy(csv_path, output_path, csv_path_size);
-        csv_path[csv_path_size-1] = '\0';
-        char *dot = strrchr(csv_path, '.');
+        strncpy(out_path, output_path, out_path_size);
+        out_path[out_path_size-1] = '\0';
+        char *dot = strrchr(out_path, '.');
         if (dot) {
-            strcpy(dot, ".csv");
-        } else {
-            strcat(csv_path, ".csv");
-        }
-    } else {
-        strcpy(csv_path, "fps.csv");
-    }
-}
-
-static void keep_last_n_lines(const char *csv_path, int n) {
-    FILE *f = fopen(csv_path, "r");
-    if (!f) return;
-    char *lines[FPS_CSV_HISTORY_LIMIT+1];
-    int count = 0;
-    char buf[256];
-    while (fgets(buf, sizeof(buf), f)) {
-        lines[count] = strdup(buf);
-        count++;
-        if (count > n) {
-            free(lines[0]);
-            memmove(lines, lines+1, sizeof(char*)*n);
-            count = n;
-        }
-    }
-    fclose(f);
-    f = fopen(csv_path, "w");
-    if (f) {
-        for (int i = 0; i < count; ++i) {
-            fputs(lines[i], f);
-            free(lines[i]);
+            *dot = '\0';
         }
-        fclose(f);
+        if (strlen(out_path) + strlen(ext) < out_path_size)
+            strcat(out_path, ext);
     } else {
-        for (int i = 0; i < count; ++i) free(lines[i]);
+        snprintf(out_path, out_path_size, "fps%s", ext);
     }
 }
 
@@ -858,10 +1164,18 @@ static void fps_analyzer_get_defaults(obs_data_t *settings)
     obs_data_set_default_double(settings, "update_interval", 1.0 / 30.0);
     obs_data_set_default_bool(settings, "enable_csv", false);
     obs_data_set_default_bool(settings, "clear_csv_on_start", true);
+    obs_data_set_default_bool(settings, "enable_event_log", false);
     obs_data_set_default_bool(settings, "enable_tearing_detection", true);
     obs_data_set_default_double(settings, "tearing_sensitivity", 1.0);
     obs_data_set_default_int(settings, "analyze_method", ANALYZE_LAST_LINE);
     obs_data_set_default_double(settings, "sensitivity", 0.1);
+    obs_data_set_default_int(settings, "sample_rows", 32);
+    obs_data_set_default_bool(settings, "sample_jitter", false);
+    obs_data_set_default_int(settings, "sample_column_step", 1);
+    obs_data_set_default_int(settings, "analysis_threads", 1);
+    obs_data_set_default_int(settings, "history_length", FA_HISTORY_DEFAULT);
+    obs_data_set_default_int(settings, "readback_depth", 3);
+    obs_data_set_default_bool(settings, "use_worker", false);
 }
 
 // --- Source info ---
@@ -0,0 +1,484 @@
+#pragma once
+// Generated by tools/fps-analyzer-fontgen from Source Code Pro Bold. Do not edit.
+//
+// Source Code Pro: Copyright 2010, 2012 Adobe Systems Incorporated
+// (http://www.adobe.com/), with Reserved Font Name 'Source'. Licensed under
+// the SIL Open Font License, Version 1.1 (http://scripts.sil.org/OFL); see
+// fps-analyzer-font-OFL.txt for the full notice and license text.
+//
+// Signed distance field of ASCII 32..126, 20 field pixels per em. Glyph
+// cells: pen at x = FONT_PAD, baseline at y = FONT_PAD + FONT_ASCENT; each glyph
+// keeps the samples at x, y, w x h of its cell. Samples: 128 on the outline,
+// 127 / FONT_RANGE more (inside) or less (outside) per field pixel.
+#include <stdint.h>
+
+#define FONT_EM 20
+#define FONT_PAD 3
+#define FONT_ASCENT 19.7500f
+#define FONT_DESCENT 5.5000f
+#define FONT_ADVANCE 12.0000f
+#define FONT_RANGE 4.0f
+#define FONT_FIRST 32
+#define FONT_LAST 126
+#define FONT_FIELD_SIZE 26621
+
+struct font_glyph {
+    uint8_t x, y, w, h;
+    uint32_t offset;
+};
+
+static const struct font_glyph font_glyphs[95] = {
+    {0, 0, 0, 0, 0}, // ' '
+    {4, 6, 10, 20, 0}, // '!'
+    {2, 6, 14, 14, 200}, // '"'
+    {1, 7, 16, 19, 396}, // '#'
+    {1, 5, 16, 23, 700}, // '$'
+    {0, 7, 18, 19, 1068}, // '%'
+    {0, 6, 18, 20, 1410}, // '&'
+    {4, 6, 10, 14, 1770}, // '''
+    {4, 5, 12, 24, 1910}, // '('
+    {2, 5, 12, 24, 2198}, // ')'
+    {1, 8, 16, 16, 2486}, // '*'
+    {1, 8, 16, 16, 2742}, // '+'
+    {4, 15, 11, 15, 2998}, // ','
+    {1, 12, 16, 8, 3163}, // '-'
+    {4, 15, 10, 11, 3291}, // '.'
+    {1, 6, 16, 23, 3401}, // '/'
+    {1, 7, 16, 19, 3769}, // '0'
+    {2, 7, 15, 19, 4073}, // '1'
+    {1, 7, 16, 19, 4358}, // '2'
+    {1, 7, 16, 19, 4662}, // '3'
+    {1, 7, 16, 19, 4966}, // '4'
+    {1, 7, 16, 19, 5270}, // '5'
+    {1, 7, 16, 19, 5574}, // '6'
+    {1, 7, 16, 19, 5878}, // '7'
+    {1, 7, 16, 19, 6182}, // '8'
+    {1, 7, 16, 19, 6486}, // '9'
+    {4, 9, 10, 17, 6790}, // ':'
+    {4, 9, 11, 21, 6960}, // ';'
+    {2, 7, 14, 18, 7191}, // '<'
+    {1, 10, 16, 13, 7443}, // '='
+    {2, 7, 14, 18, 7651}, // '>'
+    {2, 6, 14, 20, 7903}, // '?'
+    {1, 7, 16, 22, 8183}, // '@'
+    {0, 7, 18, 19, 8535}, // 'A'
+    {1, 7, 16, 19, 8877}, // 'B'
+    {1, 6, 16, 20, 9181}, // 'C'
+    {1, 7, 16, 19, 9501}, // 'D'
+    {2, 7, 15, 19, 9805}, // 'E'
+    {2, 7, 15, 19, 10090}, // 'F'
+    {1, 6, 16, 20, 10375}, // 'G'
+    {1, 7, 16, 19, 10695}, // 'H'
+    {1, 7, 16, 19, 10999}, // 'I'
+    {1, 7, 15, 19, 11303}, // 'J'
+    {1, 7, 17, 19, 11588}, // 'K'
+    {2, 7, 15, 19, 11911}, // 'L'
+    {1, 7, 16, 19, 12196}, // 'M'
+    {1, 7, 16, 19, 12500}, // 'N'
+    {1, 6, 16, 20, 12804}, // 'O'
+    {1, 7, 16, 19, 13124}, // 'P'
+    {1, 6, 17, 23, 13428}, // 'Q'
+    {1, 7, 17, 19, 13819}, // 'R'
+    {1, 6, 16, 20, 14142}, // 'S'
+    {1, 7, 16, 19, 14462}, // 'T'
+    {1, 7, 16, 19, 14766}, // 'U'
+    {0, 7, 18, 19, 15070}, // 'V'
+    {0, 7, 18, 19, 15412}, // 'W'
+    {0, 7, 18, 19, 15754}, // 'X'
+    {0, 7, 18, 19, 16096}, // 'Y'
+    {1, 7, 16, 19, 16438}, // 'Z'
+    {4, 6, 12, 23, 16742}, // '['
+    {1, 6, 16, 23, 17018}, // '\\'
+    {2, 6, 12, 23, 17386}, // ']'
+    {2, 6, 14, 14, 17662}, // '^'
+    {1, 21, 16, 8, 17858}, // '_'
+    {2, 4, 12, 11, 17986}, // '`'
+    {1, 10, 16, 16, 18118}, // 'a'
+    {1, 6, 16, 20, 18374}, // 'b'
+    {1, 10, 16, 16, 18694}, // 'c'
+    {1, 6, 16, 20, 18950}, // 'd'
+    {1, 10, 16, 16, 19270}, // 'e'
+    {2, 5, 16, 21, 19526}, // 'f'
+    {1, 10, 16, 20, 19862}, // 'g'
+    {1, 6, 16, 20, 20182}, // 'h'
+    {2, 5, 13, 21, 20502}, // 'i'
+    {1, 5, 14, 25, 20775}, // 'j'
+    {1, 6, 17, 20, 21125}, // 'k'
+    {1, 6, 16, 20, 21465}, // 'l'
+    {1, 10, 17, 16, 21785}, // 'm'
+    {1, 10, 16, 16, 22057}, // 'n'
+    {1, 10, 16, 16, 22313}, // 'o'
+    {1, 10, 16, 19, 22569}, // 'p'
+    {1, 10, 16, 19, 22873}, // 'q'
+    {2, 10, 15, 16, 23177}, // 'r'
+    {1, 10, 16, 16, 23417}, // 's'
+    {1, 7, 16, 19, 23673}, // 't'
+    {1, 10, 16, 16, 23977}, // 'u'
+    {1, 10, 16, 16, 24233}, // 'v'
+    {0, 10, 18, 16, 24489}, // 'w'
+    {1, 10, 16, 16, 24777}, // 'x'
+    {1, 10, 16, 20, 25033}, // 'y'
+    {1, 10, 16, 16, 25353}, // 'z'
+    {2, 6, 14, 23, 25609}, // '{'
+    {5, 5, 8, 26, 25931}, // '|'
+    {2, 6, 14, 23, 26139}, // '}'
+    {1, 11, 16, 10, 26461}, // '~'
+};
+
+// Base64
+static const char font_field_b64[] =
+    "ARMjKSkpKSMTARIrP0hISEg/KxIgPlhoaGhoWD4gJURkf4GBgWREJSNCYH+YmH9gQiMhQGB/mJh/YEAhIUBgf5WVf2BAIR09XHyU"
+    "lHxcPR0dPVx8kJB6XDwdGTlYeJCQeFg5GRg4V3SMjHRXOBgVNVR0gYF0VDUVITxSaHR0aFI8IS5MaH+IiH9oTC41VHSIpaWIdFQ1"
+    "NVR0iKWliHRUNS5MaH+IiH9oTC4hPFJodHRoUjwhDyU8TFRUTDwlDwEPIS41NS4hDwEXKDAxMTEuLzExMTAnFC1EUFBQUExNUFBQ"
+    "T0EqPVpvcHBwZmlwcHBuVjlAYH+IiIhwdIiIiHxcPUBgf5ioiHB0jKiUfFw9QGB/mKiIcHSMrJR8XD1AYHyUpIRvc4iokHpcPDxb"
+    "eJCggWpuhKSMdFc4NlV0jJuBZGiBnYhwUTMxUHCGlX9gZH+YhGxMLixMa4GEfFxgfISBaEgpJUNebGxoUVRqbGxbPyMYMUVMTEs8"
+    "PktMTEMuFAQZKC0tLCEjLC0tJhYBAQEBFy06PT02PD09NSMLAQEBDSpEWFxcUltcXE84HAEBARY0U3F8fGZ2fHxjRCQFARcqOVh4"
+    "j4Fof5R/YEIjCREtRFNcfJKBZH+UfFxLNhwbOlhxdH+Wf3R/kHh0Y0YnHT1cfIyMmoyMjZeMgWhIKR09XHyIipKIiI+PiIFoSCka"
+    "OVZucISMdHOIhHBwYEQmJkRgcHCIiHB2jIFwblY5GilIaIGIj4yIiJWKiHxcPR0pSGiBjJeMjIydjIx8XD0dJ0ZjdHyRgXR/lHx0"
+    "cVg6Gxw2S2B/lX9of5B4W1NELREJJURkf5R8a4GMdFc4KhcBCSlIaIGEeG+EhHNUNBUBAQYlQ15sbGhjbGxjSi0PAQEBGDFFTExL"
+    "SExMSDYeAwEBAQQZKC0tLCotLSodCQEBAQEBAQEPJDI1NTMoFQEBAQEBAQEGIzxPVFRSQSkOAQEBAQEBDy9NaXR0blU2FwEBAQEB"
+    "CRwxUHCIjHhYOSMSAQEBCSA2SFZwiJB4Wk4+KxUBARw2TWNzfIiQf3hqWEEqDw0qR2N6hpKboJaMf25WORoXNVNxhKCXiIiNmop6"
+    "XDwdGTlYeJCkhHRweIF8Y00zFhk5WHiMqIx/dmtuZk84IAcUMk9rgZWkloyBfGtYQSgOCCVAW3F/ipWfnY+BblQ4GgUfOlJkaHR/"
+    "hJGlknxgQiMWMUtmf3ZoY25/lZyBZEQlJEFddoqKgX98f5iWf2NEJClIaIGRn5uUlJqahnRYPB0kQVtuf4SMlZeIgXZgSS4RFi5B"
+    "U2FudIiQeGtdSjMdAwEWKDhFUHCIkHhYQTEdBgEBAQ0bMVBwiIx4WDkZBQEBAQEBDy9NaXR0blU2FwEBAQEBAQYjPE9UVFJBKQ4B"
+    "AQEBAQEBDyQyNTUzKBUBAQEBAQEQIS84OTcuHw4aJigfDgEBAREoPExXWFZKOiUzREg7JQ8BCCQ+VWh0eHRmUjtKYGZSPCUOFzNP"
+    "an+KkIh/Zkxedn9pUjsfID9eeo2MgY+KdlpxhI9/ZkgoJURkf5iBa4GVf25/loZ6Y0YnJURkf5yBaIGYf3+ShHZgTTYcI0Jgf5SB"
+    "dISQfISEdGBKMyAJGzlWc4SXjJaBb3R0al5MNh0DDyxHXnSBgYFxdn+EgXhjSS4RARoxR1pmfH9xhJeIlYZ0WDwdESg/Uml8jIZ8"
+    "koRxgZZ/Y0QkIT1Va3+Pinp/mIFof5yBZEQlKEhof4+PfGZ8lIRsgZh/ZEQlJUNedISBaVd0iJKBj4x4Wz0eGDFHXnRuVUpjeoSM"
+    "hnxmTjEVBBoxR1dVQTZNY3B0cGVPOSIHAQQaLjg2KSA2R1FUUkg5IwwBAQECERgXDgkcKjM1MyseDAEBAQEBAQkXICUlIRgMAQEB"
+    "AQEBAQEBDyQ1P0REQDYnEgEBAQEBAQEPJTxPXmRkX1M/KBEBAQEBAQUhPFJpfH9/fGtVPiMHAQEBAREvTGh/jZiYkX9qTjASAQEB"
+    "ARo4V3SKmIGBlYx0VzgYBgEBAR09XHySkHh4kJB4WDkpJRgEAR09XHyRkXx/mIh0VUhIQzEZARg3VnSIm4SVkX9maGhoXkUoCCM8"
+    "Uml/nKSMf2t0gYGBbEwtFjNPaX+PoaKKeGB8kZiBZUcoHz5ceoyhho+dhnp/m4x4Wz0fJURkf5iVf3+SnYqMm4FrTzIVJURkf5uU"
+    "f26BkqKkjXpmWEAlIkFgf5Kfhn9/hqSkl4Z/a0wsGzhVcYSYoJSUn5GGlpqBZkgqDipGXnSBiIyIhHxzf4R8Xj8hARoxR1tocXR0"
+    "bmFYZXBuVTYYAQQaLz9LU1RUT0U8SFJSQSkOAQEDFCMtNDU1MCgfKjMzKBUBBhwrMTExMSscBhozSFBQUFBIMxomRGBwcHBwYEQm"
+    "KUhogYiIgWhIKSlIaIGgoIFoSCkpSGiBoKCBaEgpKEhof5ycgWhIKCREY3+YmH9jRCQfPlx8kpR8XD4fGjlYeI2NeFg5GhU0VHOE"
+    "hHRUNRUPLUpjbGxjSi4QAx42SExMSDYeAwEJHSotLSodCQEBAQEBFCcwLyMQAQEBAQEVK0FPTTwpFQEBARIrQVhuaVVBKxIBDCY/"
+    "WG5/f25YPiACHThSa3+VkoFkRCURLkhjfI+VgWtVPB8ePFh0hp2EcVg/KBAqSGV/lo98X0UrEgEzUXCEoIRuUTUZAQE6WHiNmIFk"
+    "RigKAQE+XHyUlHxcPh8BAQFAYH+YkHhYOhsBAQFAYH+YkHhYORkBAQFAYH+UkHxcPR0BAQE8XHqQlX9gQiQGAQE2VXSInIFqTC8S"
+    "AQEuTGqBm4p0WD4kCgEjQV56jZaBaU82IAkXM09rgZeNfGNNNRoIJT9adISdinphQyQBEy5HYHaGhHphQyQBAhszSmB2dGBNNRoB"
+    "AQYdM0pbWEczIAkBAQEGHTE8Oi4aBwEBARAjLzAnFAEBAQEBFSk8TU9BKxUBAQESK0FVaW5YQSsSAQEgPlhuf4FuWD8mDQElRGR/"
+    "kpWBa1I5HgMfPFVrf5WPf2VJLhEQKD9YcYSdhnRYPB8BEitFX3yPln9lSCoBARk1UW6EoIRwUjMBAQooRmR/mI14WDoBAQEfPlx8"
+    "lJR8XD4BAQEbOlh4kJh/YEABAQEZOVh4kJh/YEABAQEdPVx8kJR/YEABAQYkQ2F/lZB6XDwBARMvTGqBnIh0VTYBCiQ+WnSKm4Fq"
+    "TC4JIDZPaX+XjXpeQSQaNU1jfI2XgWtPMxckQ2F6ip2EdFs/JQgkQ2F6hIZ2YEcuFAEaNU1gdHZgSjMbAgEJIDNHWFtKMx0GAQEB"
+    "BxouOjwxHQYBAQEBAQEBARQhJSUhFAEBAQEBAQEBARYuP0REPy4WAQEBAQEBBgwmQ1tkZFtDJgwGAQEBESMsL01sf39sTS8sIxEB"
+    "Dyg+S0tQcIiIcFBLSz4oDxw6VWpqYXCIiHBhampVOhwmRGN/gX94jIx4f4F/Y0QmLUxsgY+VjJWVjJWPgWxMLShFXm56gYympoyB"
+    "em5eRSgZMUNRXnaKmJiKdl5RQzEZBBw2UmuBmoGBmoFrUjYcBAgnRmN8j4Z0dIaPfGNGJwgIKEdlfIR6YGB6hHxlRygIAR45T2Fw"
+    "Y01NY3BhTzkeAQEMIzVHUEo2NkpQRzUjDAEBAQkbKjEtHh4tMSobCQEBAQEBAQkaJCUlIxgGAQEBAQEBAQYgNUNEREIzHQMBAQEB"
+    "AQEUMUxhZGRfSS4QAQEBAQENGTlYeH9/dFQ1FQ0BAQYcKzE5WHiQjHRUNTErHAYaM0hQUFh4kIx0VFBQSDMaJkRgcHBweJCMdHBw"
+    "cGBEJilIaIGIiIiVkoiIiIFoSCkpSGiBlJSUnZqUlJSBaEgpKEhmfHx8fJCMfHx8fGZIKB87UlxcXHiQjHRcXFxSOx8OJTY9PVh4"
+    "kIx0VD09NiUOAQwYHTlYeIiIdFQ1HRgMAQEBARc1U2twcGlPMhMBAQEBAQEMJz9OUFBNPCQIAQEBAQEBARIlLzExLyMPAQEBAQEG"
+    "FyMpKSUaCgEBCSAyQUhIQzYlDwEdNkxeaGhhUTwjCC5JY3h/gXxpTzMXN1Z0hpudjHpePyE5WHiQr7iagWVHKDZVc4aYnaCBaEgp"
+    "LEhgdn+EnYFoSCkoPk5edoqWf2NEJThUaniEmoh0WDwdPVx8jJqKfGNKLhE2VXGEgXhmTzgeAypIY3RrXkw5IwsBHTZLVE1BMiAM"
+    "AQEJHy81LyUXBgEBAQYcKzExMTExMTExMTErHAYaM0hQUFBQUFBQUFBQSDMaJkRgcHBwcHBwcHBwcGBEJilIaIGIiIiIiIiIiIFo"
+    "SCkpSGiBlJSUlJSUlJSBaEgpKEhmfHx8fHx8fHx8fGZIKB87UlxcXFxcXFxcXFxSOx8OJTY9PT09PT09PT09NiUOAQkYJCkpIxcH"
+    "AQwjNUJISEEzIAkiOU9faGheTTYeMU5mfIGBemNKLj1beIycm4h0VzlAYH+YtbKUfFw9QF98kaimjXhbPDZTboGKiIFrTzMoQVhq"
+    "dHRoVT8lFSs/TVRUTD0oEgETIy81NS4hEQEBAQEBAQEBFy09QEBANiMLAQEBAQEBDipEWmBgYE84HAEBAQEBARo2VXF/f3xjRCQB"
+    "AQEBAQclQmB8kZB8X0EiAQEBAQESL01rgZyEcVM1GAEBAQEBHTxYdoqYgWZIKg0BAQEBCylHZH+WjHhbPR8CAQEBARc0UW+En4Fs"
+    "TzIVAQEBAQQhP156j5R/YUQmCAEBAQEPLUtof5qIdFY5GwEBAQEBGzhWc4iagWhLLhABAQEBCCZDYX+Sj3xePyMEAQEBARQxTmyB"
+    "nYRwUjUXAQEBAQEfPFp4jJZ/ZUcqDAEBAQEMKkhlf5aMdlo8HgEBAQEBFzVTcISdgWtOMBMBAQEBBiNBXnyQknxgQyUIAQEBAREu"
+    "TGp/m4hzVTgaAQEBAQEcOVd0iJqBaEotDwEBAQEBJERjf4yMelw/IQMBAQEBASNCX3R0dGtRMxYBAQEBAQEYM0lUVFRRPyYKAQEB"
+    "AQEBBh0uNTU1MyYSAQEBAQEBAQEBARAfLTQ5OTQtHxABAQEBARUqPEpUWFhUSjwqFQEBARMrQVZmc3h4c2ZWQSsTAQglP1huf4iP"
+    "j4h/blg/JQgXM09rf5WdkJCdlYFrTzMXIT9eeo2dhHx8hJ2Nel4/ISlIaH+aj3xfX3yPmoFoSCkuTGyEoYhxdnhxiKGEbEwuMVBw"
+    "iKSEfIyMfISkiHBQMTFQcIikhH+bm4GEpIhwUDExUHCGpIR4hIR6hKSGcFAxLUxshKCIdG9wdIighGxMLShHZX+YkXxjY3yRmIFl"
+    "RygfPVt4jKCKf3+GoIp4Wz0fFTFOaH+PoZSUoY9/aEwxFQciPFRrf4SMjIR/alQ8IQYBDyg/UmNvdHRvY1I+KA8BAQESJThHUFRU"
+    "UEc4JREBAQEBAQ0cKTA1NTApHA0BAQEBAQwTGygzNTUzJhIBAQEGGyoyOUVSVFRRPyYKAQEbM0dQV2FvdHRrUTMTAQEpR2BwdH+E"
+    "jIx0VDUVAQEtTGyEjJSfrIx0VDUVAQEtTGyEkJCXrIx0VDUVAQEsS2h4eHiMrIx0VDUVAQEhPFFYWHSMrIx0VDUVAQEPJTQ5VHSM"
+    "rIx0VDUVAQEBChY1VHSMrIx0VDUVAQERISg1VHSMrIx0VDUmGgYoPUhIVHSMrIx0VEhEMxw6VWhoaHSMrIx0aGhgSCtAYH+BgYGN"
+    "rI2BgYFwUDFAYH+YoKCkpKSgoIhwUDFAYH+EhISEhISEhIRwUDE8WGtsbGxsbGxsbGxjSi0rQExMTExMTExMTExINh4UJSwtLS0t"
+    "LS0tLS0qHQkBAQ4eKjM4OTgzKRwLAQEBARUoOkhSWFhYUUc4JQ8BARcuQVRlcHZ4dm9jUTwlCwEqRFtuf4SMkIyEfGlROBwBNFNx"
+    "f5KbkZCWoY98Y0cpCzJPaX+PgXx4f5KhhG9QMhMkPFJpf25eW3CEpIx0VDUVDyU8UmBYQ1FwhKSIdFQ1FQEPJThAPEpjfI+bgWtN"
+    "LxABAQ0eM0hedoaginheQSUHAQ0iNkpgdISaj39mTDIZBA8lOU5jdoaakoFrUkxFMRgjPFJmeoidj4FsbGxsXkMlL01pf4ygnIGE"
+    "hISEgWhIKTFQcIiipKSgoKSkoIFoSCkxUHCEhISEhISEhISBaEgpLUpjbGxsbGxsbGxsbF5DJR42SExMTExMTExMTExFMRgJHSot"
+    "LS0tLS0tLS0tKBkEAQEPHiozODk5NCshEgEBAQQaLDpIUVhYWFNKPi0XAQEZMUZWZXB2eHhxaFhELhYBKEVecX+EjJCMhn9xW0Mo"
+    "DC1MbISVnZKQlaOWgW5SNBYoRV52iIF8eH+Nqo96XDwdGTJKY3puX1hshKSUfFw9HQYeNk1camxxfIygiHRXORoBCSA9XHyEiJGS"
+    "hHpjSi4RAQYdPVx8lJqgin90YEoxFQMdM0Rcen+BhJKYhnZcPyEWMElgZl9gZG5/mpqBZkgoKUNcdH9vZGBpf5iggWhIKTZVboGS"
+    "hH9/f4ykloFkRic4WHaElaGYmJyhlYRxWDwfL0pgc3+EiIyIhH9xXkYtER0zR1ZlbnR0dG5lVkUxGgEGGiw6R09UVFRPRzosGQQB"
+    "AQEPHikwNTU1MCkeDwEBAQEBAQEBDyMvMTExMSscBgEBAQEBCiU8TVBQUFBIMxoBAQEBAx02UWlwcHBwYEQmBwEBARQvSWN8iIiI"
+    "gWhIKQkBAQ0nQVt0hqCmoIFoSCkJAQUfOVNuf5iGkaCBaEgpCQEYMUtmf5GPfJCggWhIKQkQKURedoqagXiQoIFoSCkLIjxVb4Ga"
+    "iHZ4kKCBaEg4IzNOaH+Sj39leJCggWhjTzU8XHqMoIF/f3+QoIF/fFw9PVx8lKScnJyco66clHxcPT1cfISEhISEhJKhhoR8XD04"
+    "VGpsbGxsbHiQoIFsalQ4KD5LTExMTFh4kKCBaEs+KBEjLC0tLTlYeISEgWhIKREBBgwNDRY0UWhsbGxeQyUGAQEBAQEKJTxLTExM"
+    "RTEYAQEBAQEBAQ8hLC0tLSgZBAEBBhwrMTExMTExMTEvJRIBARozSFBQUFBQUFBQTj8nDAgmRGBwcHBwcHBwcGtTNRcNLUxsgYiI"
+    "iIiIiIh4WDkZDS1MbISkoqCgoKCQeFg5GRAwT26EpIqBgYGBgXhYORkRMVBwiKSEbmhoaGhlTzMVEzJQcIiggX9/fHRmVD8lDBU1"
+    "VHSMppGUmJSKf2tSNhoVNVR0hI+EgYSVpI98YUMlEC5JX3F8bmhxgZqdgWpLLBMtR15oXFFIXnyUpIRsTC0lP1hzf3NlYGp/mJ+B"
+    "a0wsMk9rf5WEf39/j6WSf2NEJjRTcYGRn5iYnKCSgW5UOBwqRFtufIGIjIqEf25YQSgOFy5DU2Fsc3R0bmNUQSsVAQEWKDZETlRU"
+    "VE9GOCgVAQEBAQwaJi80NTUwKBwOAQEBAQEBBhclLzc5OTQrHxEBAQEBCR8yQU1WWFhTSjwtGgQBByA2S15rdHh4cWZYRzEYARoz"
+    "TWN2gYqQjYZ/c15DJQwoRWB6ipublJSdloFoSCkYNlNvhJ2VgXx8gYRxWz8jIkFffJGbgW5gYG50XkUuFChIZn+bkHxveHhzZlU/"
+    "Jw0tTGyBoIx8hIyPiH9rUzgcLUxshKSPjJCMkaKRf2NGKC1MbISil4R8dHyNoIRsTi8qSGiBnZB4XlVuhKSIcFAxJURjf5WWf2he"
+    "cYakhHBQMRw6V3SGoYx/fIGVmIFoSywRLkljfIydmJSamIZ0Wz8hAx04T2Z6gYiMiIF0YEgvFAELIzlOX2tzdHBoWkgzHAMBAQwi"
+    "NENNVFRSSz4vHAYBAQEBCBglLzQ1My0hEwMBAQkeLTExMTExMTExMTEtHgkdNkpQUFBQUFBQUFBQSjYdKkhjcHBwcHBwcHBwcGNI"
+    "Ki1MbISIiIiIiIiIiIRsTC0tTGyEoKCgoKCgqKKEbEwtLUxsgYGBgYGBgZiPf2ZKKyhFXmhoaGhoeIqVgWpSOR8ZMUNISEhVcYSd"
+    "hHFYPiUNBBglKSxIZX+SkHxhRiwRAQEBBho4VXOGoYRvUzUaAQEBAQUkQmB8kpiBZUcpDAEBAQEMLEtogZySfF4/IAEBAQEBEzJQ"
+    "cISkjXhYORoBAQEBARY1VHSMqox0VDUVAQEBAQEZOVh4j6iIcFIzFAEBAQEBGTlYeIiIiHBQMREBAQEBARY0UWlwcHBmTC4PAQEB"
+    "AQEKJTxNUFBQTDkhBQEBAQEBAQ8jLzExMS4hDAEBAQEBAQETIy41OTk2LyMVAwEBAQEXLT9MVFhYVU0/MBoEAQEXLkRaanR4eHRq"
+    "XEcxGAEMKERbcX+Ij5CKgXReRCgMFjRSb4GXloiIkpqBb1M1Fx08XHqPm4F0c3+WkHpcPB0dPVx8lJh/Y1h4kJR8XD0dGzpYeIyh"
+    "hnxvf5WKdlg5GhQxTml/j5+RhIyMfGZLLxIWMUpgdH+YlaCdhHxmTzgcI0FddoaXgX+EkZ+MfGNHKSxLaH+aiHNjb3+PoYRuTzAt"
+    "TGyEpIRvWFdwiKiIcFAxLEtogZuRf3h0f4+fhGxOLyRBXniKmpaMjJWbjHxhRSgXMkxjdoGIjIyIgXpmTzUaBiA2S1xocHR0cGpe"
+    "TjkjCQEJHzE/S1FUVFFLQTMiDAEBAQUVIy0zNTUzLSQXBwEBAQEIGCcwODk4MygaCgEBAQEMIjRDT1dYWFFFNiUPAQEIIjlOX250"
+    "eHZvYVE8JQ4BGjROZnqBjJCMhHxpUjofBSdEYHqMnZaQlJ+Pf2ZLLxMwT26BnY+BeH+Ko4p2WjwdNVR0iqCBbFpmf5WWf2REJjVU"
+    "dIyggWtYYXiMn4FoSiszUXCEoox/eH+GmqSEbEwtKkhlf5KhlJCUio2khGxMLR46VGt/hIyIgXaMoIFrTCwOKD9UZW90dGt8kpqB"
+    "ZkgoGjNKY3pvZGRxhJ2PfF4/IShFYHaGhH9/hJeagW5RNRctTGyElaCYmKCXhnZeQycKKEVecX+EioyGgXRgSjEYARkxRVZlbnR0"
+    "cGhaSDMdBQEEGSo6R09UVFFKPi4cBgEBAQEPHikwNTUzKyETAgEBAQEWJzM5OTIlFAEXLkNRWFhPQCsUKkRbbnh4a1hBJzhVcYGN"
+    "jIFuUTRAYHySq6qPelw8QGB/lrSxknxcPTxadoqYmIZzVjgvS2N4gYF2YEgsIjlPX2hoXk02HjFOZnyBgXpjSi49W3iMnJuIdFc5"
+    "QGB/mLWylHxcPUBffJGopo14Wzw2U26BioiBa08zKEFYanR0aFU/JRUrP01UVEw9KBIBEyMvNTUuIREBARYnMzk5MiUUAQEXLkNR"
+    "WFhPQCsUASpEW254eGtYQScKOFVxgY2MgW5RNBZAYHySq6qPelw8HUBgf5a0sZJ8XD0dPFp2ipiYhnNWOBovS2N4gYF2YEgsDx82"
+    "TV9oaF9POR8FL0tjen+BemZLLxM4WHaKm5yKdlo8HT1cfJKxtJZ/YUMkOFd0iJifnIFkRCUuSmN4gYiagWREJStATmB6jZJ8X0Ah"
+    "PFhreoSdhHFVOBpAYH+Mmoh6YUcqDjlWc4iBdmNNNRsBLUpmdGpcSjYgCQEfOU5UTD8wHgkBAQwiMDUvIxUEAQEBAQEBAQEBAQER"
+    "Iy8vJRIBAQEBAQEJGyw9TU4/JwEBAQECEyU1R1hpa1M1AQEBDB0uP09hc394WDkBBBYmOEhaa3yEkHhYOQYdMEFSY3R/jZ+NeFg5"
+    "GjNKXGt8hpeVhHxrUzUmRGB2gY+aioFxYU8/JylIaIGakoF4aFZGNSUSKUhogaCMf3FgTz8uHQkoSGZ8hpeVhHxqWkk2IB87UmN0"
+    "gY2djYF0Y0wxDiU2SFpqfISVl4Z4WDkBDBwuPk9hcX+MkHhYOQEBAhMkNUZYaHqEeFg5AQEBAQkaLD1OX29xVjcBAQEBAQERIjNF"
+    "VVZELAEBAQEBAQEHGSk2NywXDiU2PT09PT09PT09PTYlDh87UlxcXFxcXFxcXFxSOx8oSGZ8fHx8fHx8fHx8ZkgoKUhogZSUlJSU"
+    "lJSUgWhIKSlIaIGIiIiIiIiIiIFoSCkmRGBwcHBwcHBwcHBwYEQmJEFbaGhoaGhoaGhoaFtBJClIaIGBgYGBgYGBgYFoSCkpSGiB"
+    "nJycnJycnJyBaEgpKUhogYGBgYGBgYGBgWhIKSM/WGRkZGRkZGRkZGRYPyMTKz5EREREREREREREPisTARIgJSUlJSUlJSUlJSAS"
+    "AQ8jLy8lEwMBAQEBAQEBJDxNTj8uHQwBAQEBAQEyT2lrWkk4JxYEAQEBATVUdIF0Y1JBMB8OAQEBNVR0jIZ8blxKOigYBgE1VHSM"
+    "nY+BdmZUQzIgCTJPaXqBkpqIf25eTDYdJDxOX29/iJiSgXhjSCoPIzNEVWZ2gY+bhGxMLQYbLD1OXm9/iqKEbEwtHTNHWGh6gZKa"
+    "iH9qSywuSWBzf4ybj4F2ZVQ+IzVUdISVl4Z8a1xKOSgRNVR0jI2BdGNSQDAeDgE1VHSEfGpaSDgmFQQBATNSbnFhTz8uHAwBAQEB"
+    "KEFVVkc1JBMCAQEBAQEVKTY3LBsJAQEBAQEBAQEBDBomLjExLSYaDAEBARQnNkRMUFBMRDYmEgEVK0FTYWxwcGthUj8oDyhBWG58"
+    "gYiIgXxrVTsfM1Juf5GfnJ+fj39mSi0zUWt/j4SBgZWkiHFTNCY/VWl/cWVziKiMdFQ1Eig8UmBYY3qNn4RwUTMBECU4TWZ8ip2K"
+    "emFHKgEEI0FeeoqfhnpjTTUbAQkpSGh/m416YU02IAkBCSlIaIGEhHBSNSAJAQEMKENebHRxY001GgEBARc1U25/jIZ6YUQmCAEB"
+    "HT1cfJCpn4FsTC0NAQEdPVx8kKmfgWxMLQ0BARc1U26BjIZ6YUQmCAEBDChBWGt0cWNNNRoBAQEBFStATlRTSDYgCQEBAQEBFCUw"
+    "NTQrHQkBAQEBAQEKGigyODk5MyocCgEBAQEPJTZFT1dYWFJHNiMMAQEPJTxRYW50eHhwY085IggIIzxSaXyEjJCMhHxmTzQYGDRP"
+    "aX+PkoSBhJKMel9CJSZDX3qMkoFxaG9/lYFrTC4wTmyBmoFrVU5WdIiIcVM0OFd0jI14XGFsdHyIjHRUNT1cfJKEcGl8gYqQmIx0"
+    "VDVAYH+WgWt8jZKEgZCMdFQ1QGB/mIFsgZiBb3iQjHRUNUBgf5iBbISYgXR/kYx0VDU+XHyUhGx/lZKMj4aMdFQ1OVh4jIp0boGI"
+    "hH+BgXRUNTNRb4SVf2ZocG9laGhjSy8oRmN/kop6ZltbZXBgRjYfHDhUboGXin94eH+EcVU4Gw4oQ1txgY2WkJCWin9gQCEBFi5E"
+    "Wmt6gYGBf3ZoVTocAQEXLUBPXmRoaGRaTD0oDwEBARQlMz9GSEhEPC8hEQEBAQEBCBcgJykpJR0TBQEBAQEBARIoOD09PT04KBIB"
+    "AQEBAQEBCCU/VFxcXFxUPyUIAQEBAQEBES9Oa3x8fHxrTi8RAQEBAQEBGzlXdIqUlIp0VzkbAQEBAQEGJUNhf5SSlZR/YUMlBgEB"
+    "AQEQLkxqgZ2EiJ2BakwuEAEBAQEaOFZ0iJyBgaCIdFY4GgEBAQQjQV98kpR/f5iSfF9BIwQBAQ8tS2h/m4x4epCbgWhLLQ4BARc1"
+    "VHOIpIRwc4iliHFTNRcBAyE/XnyQoISBgYakkHxePyEDDCpIaH+apKCgoKCmmoFoSCoMFjRScISijIGBgYGPooRwUjQWHz1ceo+h"
+    "hG5oaHCGpI96XD0fKUdlf5iagWZIS2iBnJh/ZUcpLUxshISEfF4/Q2F/hISEbEwtKUdgbGxsaFI2OlVqbGxsYEcpGzNHTExMSzwl"
+    "KD5LTExMRzMbBhspLS0tLCEPESMsLS0tKRsGCyM1PT09PT09OjUtHxABARw4T1xcXFxcXFhUSjwoEgEkRGN8fHx8fHx4c2ZVPygO"
+    "JURkf5SUlJSUkIh/a1Q4HCVEZH+coYyMjJakkn9jRCUlRGR/nJyBdHaBmJ2BaEgpJURkf5ycgWRefJScgWhIKSVEZH+cnIF0eIGb"
+    "j3xfQiQlRGR/nKGMjIyYhH9pUTYeJURkf5yjkJCQlY2EemNKLiVEZH+cnIF4eH+Mn4h0VzglRGR/nJyBZFpqgaCSfFw9JURkf5yc"
+    "gWRlcYShknxcPSVEZH+cnIF/f4SXooh0VzglRGR/nKScnJygmIp8ZkouJURkf4SEhISEgYF2Zk85HyE/W2xsbGxsbGpkWkw5IwwU"
+    "LkNMTExMTExLRj0vIQwBARYmLS0tLS0tLCcfEwUBAQEBAQEBDxggJSUkHRMHAQEBAQELHCw2QEREQzwwIhEBAQEPJDhIVV9kZGFa"
+    "Tj0rFQEMJTxPY3N8f39/dmhYQSoEHjlSaXyGkZiclox/blY5Ey9KZXyNoZqPjJGdhnZbPB88WnaIopeBeHR8hHpgSjEoR2V/lqGE"
+    "cV1VYHBjTTMdLUxshKCWf2NHNkdQSjYgBzFQcIilkHxcPR0qMS0eCQExUHCIqJB4WDobHygmGgYBMVBwhKSUfF9AKDtIRDMdBixL"
+    "aoGdmoFqT0ZUZmBKMx0lQ2F8kqiMfGtkbn92YEkwGjhVb4Gaoo2Bf4GShnRcPg4pRF50hJWhn5ygmop6X0ABGDFHXnF/hIyMiIF2"
+    "Y000AQQaMUZYZW90dHBoXEs2IAEBBBosPEdQVFRRSz8xHwkBAQEBER8pMDU1My0jFQUBDiU2PT09PT06NC0fEQEBAR87UlxcXFxc"
+    "WFNKPCwXAQEoSGZ8fHx8fHhxZlhELhcBKUhogZSUlJSPiH9xW0QsESlIaIGgoJCQmKSVgXFYPB8pSGiBoJh/en+Mo5V/ZkotKUho"
+    "gaCYf2Bmf5KkiHFTNClIaIGgmH9gVnSIqI94WDopSGiBoJh/YE9uhKSUfFw9KUhogaCYf2BMbISklHxcPSlIaIGgmH9gUnCIppB6"
+    "XDwpSGiBoJh/YF56jamMdFc4KUhogaCYf2t0hJudgWtOMClIaIGgmIGBiJqijHpfQyUpSGiBoKSgoJ+WiHxmTjMYKUhogYSEhISB"
+    "f3RlTzkiByVDXmxsbGxsaGRYSjkjDAEYMUVMTExMTEtEPC4eDAEBBBkoLS0tLS0sJh0RAwEBARovOz09PT09PT09PTUjCy5HWlxc"
+    "XFxcXFxcXE84HDhXdHx8fHx8fHx8fGNEJDlYeJCUlJSUlJSUgWREJTlYeJCvmJSUlJSUgWREJTlYeJCoiHx8fHx8fGNEJDlYeJCo"
+    "iHBcXFxcXE84HDlYeJCoiHh4eHh4ZUcoCzlYeJCtlZCQkJCBaEgpCTlYeJCwm5iYmJiBaEgpCTlYeJCoiH9/f39/aEgoCTlYeJCo"
+    "iHBgYGBgVUczGzlYeJCoiHBsbGxsbGBHKTlYeJCpjISEhISEhGxMLTlYeJCkpKSkpKSkhGxMLTlYeISEhISEhISEhGxMLTRRaGxs"
+    "bGxsbGxsbGBHKSU8S0xMTExMTExMTEczGw8hLC0tLS0tLS0tLSkbBhQqOT09PT09PT09PTkqFCdBVlxcXFxcXFxcXFZBJzBPbnx8"
+    "fHx8fHx8fG5PMDFQcIiUlJSUlJSUiHBQMTFQcIionZSUlJSUiHBQMTFQcIiokHx8fHx8fG5PMDFQcIiokHhcXFxcXFZBJzFQcIio"
+    "kHhsbGxsZk4wFDFQcIiokoSEhISEdFQ1FTFQcIioqqSkpKSMdFQ1FTFQcIiokoSEhISEdFQ1FTFQcIiokHhsbGxsZk4wEjFQcIio"
+    "kHhYTExMSjkiBzFQcIiokHhYOS0tKx8MATFQcIiokHhYORkNDAMBATFQcIiIiHhYORkBAQEBAS5MZnBwcGtTNRcBAQEBASE5TFBQ"
+    "UE4/JwwBAQEBAQwhLjExMS8lEgEBAQEBAQEBAQEHExwjJSUgGA4BAQEBAQESIzA7QkREQDYqGQYBAQEVKz5OWmBkZF9VRTMgCQEU"
+    "K0FYanZ/f398cV9MNhwMJ0FYbn+MlZyYkYR4Y0YnGjZTbn+VpZWMjJaPf2ZIKCZEYXyRqI+BdHiBgWtSOx8vTmyBn5iBaldYa2tV"
+    "QTAaNVR0iqiNeFtkZGRkZF1GKjlYeJCoiHNof39/f39wUDE5WHiQqIhwaIGcnJyIcFAxOVh4jKqMdGiBiIymiHBQMTRTcYilkXxg"
+    "cHCEpIhwUDEtS2iBmp2EdGZshKSIcFAxIz9ceIqil4Z/f4ymiHBQMRUxTGZ8ipqinJyhlYRwUDEGIDlPZniBiIyKhH9xXkYqAQwj"
+    "OUxcaHB0dG5kVkUxGgEBDCExP0tSVFRPRzoqGQQBAQEGFSMtMzU1MCkdDwEBESg4PT09PDExPD09PTgoESM+VFxcXFtKSltcXFxU"
+    "PiMsS2p8fHx2W1t2fHx8akssLUxshJSUfFxcfJSUhGxMLS1MbISklHxcXHyUpIRsTC0tTGyEpJR8XFx8lKSEbEwtLUxshKSUfFxc"
+    "fJSkhGxMLS1MbISklHx8fHyUpIRsTC0tTGyEpKCUlJSUoKSEbEwtLUxshKSimJiYmKKkhGxMLS1MbISklH9/f3+UpIRsTC0tTGyE"
+    "pJR8YGB8lKSEbEwtLUxshKSUfFxcfJSkhGxMLS1MbISklHxcXHyUpIRsTC0tTGyEpJR8XFx8lKSEbEwtLUxshISEfFxcfISEhGxM"
+    "LSlHYGxsbGpUVGpsbGxgRykbM0dMTExLPj5LTExMRzMbBhspLS0tLCMjLC0tLSkbBgsjNT09PT09PT09PT01IwscOE9cXFxcXFxc"
+    "XFxcTzgcJERjfHx8fHx8fHx8fGNEJCVEZH+UlJSUlJSUlIFkRCUlRGR/lJSUpaWUlJSBZEQlJERjfHx8f5ycgXx8fGNEJBw4T1xc"
+    "ZH+cnIFkXFxPOBwLIzU9RGR/nJyBZEQ9NSMLAQkXJURkf5ycgWREJRcJAQEBCCVEZH+cnIFkRCUIAQEBFiYtRGR/nJyBZEQtJhYB"
+    "FC5DTExkf5ycgWRMTEMuFCE/W2xsbH+cnIFsbGxbPyElRGR/hISEnZ2EhISBZEQlJURkf5ykpKSkpKScgWREJSVEZH+EhISEhISE"
+    "hIFkRCUhP1tsbGxsbGxsbGxsWz8hFC5DTExMTExMTExMTEMuFAEWJi0tLS0tLS0tLS0mFgEBESg4PT09PT09PT08MyAGIz5UXFxc"
+    "XFxcXFxcTTQMLEtqfHx8fHx8fHx6X0ANLUxshJSUlJSUlJR/YEANLUxshJSUlJSVqJh/YEAMLEtqfHx8fHyBoJh/YEAGIz5UXFxc"
+    "XGiBoJh/YEABESg4PT09SGiBoJh/YEABAQ4aHR0pSGiBoJh/YEABARQnMC8pSGiBoJh/YEABFStBT008SGiBoJh/YEASK0FYbmlS"
+    "SmiBoJh/YEAjPlhuf3xrZHGEpJR8Xj8sS2p/lY+Bf4SXpYp0VzksS2h/jZ2fnKCgj4FoTC8hPFJpfIGIjIiEf2tVPCEPJTxPX2tx"
+    "dHRuY1I/KBABDyQ1Q0xTVFRPRjgmEgEBAQkYJS40NTUwKBwNAQEOJTY9PT08Myg4PT09PTUjCx87UlxcXFxNP1RcXFxcTzgcKEhm"
+    "fHx8el9Ra3x8fHxjRCQpSGiBlJR/YGN8j5SKdl5BIilIaIGgmH9gdoihj3xlSzIXKUhogaCYf2+BmpWBa1I5HwYpSGiBoJh/f5Ka"
+    "gXFYPyUMASlIaIGgmH+Mooh2XkQrEgEBKUhogaCdjKCkinZaPiMHAQEpSGiBoLWsmp2YgWpOMRYBASlIaIGgs5qBiKSMeF1BJQkB"
+    "KUhogaCghnZ/lpqBa081GAEpSGiBoJh/Y3SIpI18X0MoDClIaIGgmH9gZn+WnYFuUzYbKUhogaCYf2BYdIikkXxhRyopSGiBhIR/"
+    "YEpmf4SEhHBQMSVDXmxsbGtYPFhrbGxsY0otGDFFTExMTEArQExMTExINh4EGSgtLS0sJRQlLC0tLSodCRQqOT09PTsvGgIBAQEB"
+    "ASdBVlxcXFpHLhEBAQEBATBPbnx8fHRXOBgBAQEBATFQcIiUkHhYORkBAQEBATFQcIiokHhYORkBAQEBATFQcIiokHhYORkBAQEB"
+    "ATFQcIiokHhYORkBAQEBATFQcIiokHhYORkBAQEBATFQcIiokHhYORkBAQEBATFQcIiokHhYORkNDQsBATFQcIiokHhYOS0tLSod"
+    "CTFQcIiokHhYTExMTEg2HjFQcIiokHhsbGxsbGNKLTFQcIiokoSEhISEhHBQMTFQcIikpKSkpKSkiHBQMTFQcISEhISEhISEhHBQ"
+    "MS1KY2xsbGxsbGxsbGNKLR42SExMTExMTExMTEg2HgkdKi0tLS0tLS0tLSodCRQqOT09PTwxMTw9PT05KhQnQVZcXFxbSkpbXFxc"
+    "VkEnME9ufHx8dltednx8fG5PMDFQcIiUlH9kZn+UlIhwUDExUHCIqJ+BbG+EoaiIcFAxMVBwiJ2RinR4jIaWiHBQMTFQcIiUgZF8"
+    "f5R/mIhwUDExUHCIlH+UgYGPf5iIcFAxMVBwiJh/jISGhn+ciHBQMTFQcIiYgYSPkoGBn4hwUDExUHCInIF/lpF8gaCIcFAxMVBw"
+    "iJyBeIyIc4GgiHBQMTFQcIicgW58fGiBoIhwUDExUHCInIFkXFxogaCIcFAxMVBwiJyBZERIaIGgiHBQMTFQcISEgWRESGiBhIRw"
+    "UDEtSmNsbGxbP0NebGxsY0otHjZITExMQy4xRUxMTEg2HgkdKi0tLSYWGSgtLS0qHQkOJTY9PT09NS87PT09OCgRHztSXFxcXE9H"
+    "WlxcXFQ+IyhIZnx8fHxjV3R8fHxqSywpSGiBlJSEb1h4kJSEbEwtKUhogaCtj3xeeJCkhGxMLSlIaIGgopuBaniQpIRsTC0pSGiB"
+    "oIqNinZ4kKSEbEwtKUhogaCIhJZ/eJCkhGxMLSlIaIGgjH+UhniPpIRsTC0pSGiBoJB4iJF8jKSEbEwtKUhogaCUfH+agYikhGxM"
+    "LSlIaIGglHx4jYyEpIRsTC0pSGiBoJR8bIGakqSEbEwtKUhogaCUfGF8ka+khGxMLSlIaIGglHxccYaipIRsTC0pSGiBhIR8XGV/"
+    "hISEbEwtJUNebGxsalRYa2xsbGBHKRgxRUxMTEs+QExMTExHMxsEGSgtLS0sIyUsLS0tKRsGAQEBAQ8aIiUlIhsPAQEBAQEBCRws"
+    "OUFEREE5LBwJAQEBCSA2SFZgZGRgVkg2IAkBBR82TWNzfH9/f3NjTTYfBRUxS2N6hpSbm5SGemNLMRUjP1x2iqCajIyaoIp2XD8j"
+    "Lkxqf5qdhHh4hJ2agWpMLjVUdIimkHxfX3yQpoh0VDU6WHiQqIhzVFRziKiQeFg6PVx8lKSEbE5PboSklHxcPT1cfJSkhGxMTGyE"
+    "pJR8XD09XHyQpYhwUFBwiKWQfFw9OFh2jKqMdlhYdoyqjHZYODJQb4Sgln9qan+WoIRvUDIoRmN/kqWPgX+PpZJ/Y0YoHDhUboGS"
+    "oZycopKBblQ4HA4oQVhuf4SMjIR/blhBKA4BFStBVWVvdHRvZVVBKxUBAQEVKTpHUFRUUEg6KRUBAQEBAQ8eKTI1NTIqHg8BAQEL"
+    "IzU9PT09PT07NS4hEgEBHDhPXFxcXFxcWlRMPi0XASREY3x8fHx8fHhzaFhELhQlRGR/lJSUlJSQiH9xW0AlJURkf5yjkJCQlqSW"
+    "gWtPMiVEZH+cnIF4eH+NqIx4WDklRGR/nJyBZFtrgaCUfFw9JURkf5ycgWRXbIGgknxcPSVEZH+cnIF0dH+NqIx2WDglRGR/nKGM"
+    "jIySo5WBak4wJURkf5yomJiYkoqBblg/IyVEZH+cnIF/f3x0aFhBKxMlRGR/nJyBZGBeV0w9KxUBJURkf5ycgWREPzgvIREBASVE"
+    "ZH+cnIFkRCUaEQUBAQElRGR/hISBZEQlBQEBAQEBIT9bbGxsbFs/IQIBAQEBARQuQ0xMTExDLhQBAQEBAQEBFiYtLS0tJhYBAQEB"
+    "AQEBAQEBAQ8aIiUlIhsPAQEBAQEBAQkcLDlBRERBOSwcCQEBAQEJIDZIVmBkZGBWSDYgCQEBBR82TWNzfH9/f3NjTTYfBQEVMUtj"
+    "eoaUm5uUhnpjSzEVASM/XHaKoJqMjJqginZcPyMGLkxqf5qdhHh4hJ2agWpMLhA2VXSIpo98X198j6aIdFU2FztaeJCoiHFTU3GI"
+    "qJB4WjscPVx8lKSEbE5ObISklHxcPR09XHyUpIRsTExshKSUfFw9HT1cfJCliHBQUHCIpZB6XDwdOFh2jKqMdFhYdIyqjHRXOBgy"
+    "T26EoJV/aWl/lZ+Ebk8yEyhGY3+RpY9/f4+lkXxhRSgJHDhTa4GSoZycoZGBa1M2HQUNJ0BYbn+EmKSGf25cXkoxFQEUK0FUY3aK"
+    "pJJ/enp2WzwdAQEUKDhMZn+PoZiQkH9hQyQBAQEOITtSaXyEj5SRgWhIKQEBAQEOJTxSY3F4fHx0YEQmAQEBAQEPJThHU1pcXFZJ"
+    "MxoBAQEBAQEMHCo0Oz09Ny4dBg4lNj09PT09PTo0Kx8PAQEBHztSXFxcXFxcWFNKOygSAQEoSGZ8fHx8fHx4cWZVPygQASlIaIGU"
+    "lJSUlI+Gf2tVPB8DKUhogaCgkJCQmKSSf2ZKKw0pSGiBoJh/eHqBkqSGcFEzEylIaIGgmH9gXHGIqIx0VDUVKUhogaCYf2BgdIqo"
+    "inRUNRUpSGiBoJh/fHyBl5+Ebk8wESlIaIGgopSUlJ2djHphRSgJKUhogaCgkJCapIR6Zk81GgEpSGiBoJh/eIijj3xhRSoOASlI"
+    "aIGgmH9mf5WfhHFVOR4BKUhogaCYf2BzhqKSf2VILREpSGiBoJh/YGV/kqKGc1g8HylIaIGIiH9gVXGEiIh/ZEQlJkRgcHBwb1pH"
+    "YHBwcHBdQSIaM0hQUFBQRDNIUFBQUEYwFgYcKzExMTAoHCsxMTExKhoEAQEBAQ4aICUlJB0VCAEBAQEBCRsqOEBEREM8MyUWBAEB"
+    "CSA1R1VfZGRhW09BMB0GAx02TWFxfH9/f3hrXUozGhEuSWN6hJKYnJaNgXZgRCYdPFh0hp+ajIyQm5J/ZkgoJERjf5afhHh0fIGB"
+    "blU7HyVEZH+cnIFvY15ucVhBKA8kQ2F/lKiShH9zZlpJNiAIGzlWcYSYqJ+UiH90Y000Gg8sRl50gYyYpKSYhnpgRSgBGjFHW2p4"
+    "gYiVpZ2Ebk8wEipBW29lWmZzf5KpjHRUNSY/Vm6Bf3FoZXaMqIp0VDUzUWt/lZKEf3+EmpuBbE4vNFNxgY2bopycoZiGdl5DJipE"
+    "Wmt8gYaMjIaBdmBKMhgXLT9PX2hwdHRwaFtKMx0GARMlNUFLUVRUUUs/Lx0GAQEBCRgkLDM1NTMsIRQEAQEgMzw9PT09PT09PT09"
+    "PDMgNE1cXFxcXFxcXFxcXFxNNEBfenx8fHx8fHx8fHx6X0BAYH+UlJSUlJSUlJSUf2BAQGB/lJSUlKWllJSUlH9gQEBfenx8fH+c"
+    "nIF8fHx6X0A0TVxcXGR/nJyBZFxcXE00IDM8PURkf5ycgWREPTwzIAcWHSVEZH+cnIFkRCUdFgcBAQUlRGR/nJyBZEQlBQEBAQEF"
+    "JURkf5ycgWREJQUBAQEBBSVEZH+cnIFkRCUFAQEBAQUlRGR/nJyBZEQlBQEBAQEFJURkf5ycgWREJQUBAQEBBSVEZH+cnIFkRCUF"
+    "AQEBAQUlRGR/hISBZEQlBQEBAQECIT9bbGxsbFs/IQIBAQEBARQuQ0xMTExDLhQBAQEBAQEBFiYtLS0tJhYBAQEBESg4PT09PDEv"
+    "Oz09PTgoESM+VFxcXFtKR1pcXFxUPiMsS2p8fHx2W1d0fHx8akssLUxshJSUfFxYeJCUhGxMLS1MbISklHxcWHiQpIRsTC0tTGyE"
+    "pJR8XFh4kKSEbEwtLUxshKSUfFxYeJCkhGxMLS1MbISklHxcWHiQpIRsTC0tTGyEpJR8XFh4kKSEbEwtLUxshKSUfFxYeJCkhGxM"
+    "LS1MbISklHxcWHiQpIRsTC0tTGyEopR8Xlp4kKKEbEwtKkhogZyYgWpof5WcgWhIKiRCYHyRpo+Bf4yjknxgQiQaNlNvgZaknJyk"
+    "l4FvVTgaDChEW3F/hoyMhoFxW0QpDgEXLkRYZnB0dHBoWkQuFwEBARctPEpQVFRRSj4tFwEBAQEBER8rMjU1MyshEwEBAQ4lNj09"
+    "PTwzICAzPD09PTYlDh87UlxcXFxNNTRNXFxcXFI7HyhIZnx8fHphQ0Bfenx8fGZIKChIZn+UlIFqS0hmf5SUgWZIKCA+XHyQpYhx"
+    "U09uhKGQfFw+IBc1U3GGpI94W1d0jKWIcVM1Fw0sS2iBm5Z/Y198kpuBaEstDgQjQWB8kp+Ba2Z/mpJ8YEEjBAEaOFZ0iqaIc26E"
+    "oYp0VjgaAQERL01rgZ2QenaMn4FrTS8RAQEHJURjf5WYf3yUlX9jRCYHAQEBHDpYeIyfgX+ajHhaOxwBAQEBFDJPboShiIShhG9Q"
+    "MhQBAQEBCilHZX+YlZKYgWVHKQsBAQEBAR89XHqPpKSPelw+IAEBAQEBARY0UnCEhISEcVM0FgEBAQEBAQ0rSGBsbGxsYEgrDQEB"
+    "AQEBAQEcM0dMTExMRzMcAQEBAQEBAQEGGyktLS0tKRsGAQEBARctOj09PTsvGhctOj09PTkqFCpEWFxcXFpHLipEWFxcXFZBJzRT"
+    "cXx8fHRXODRTcXx8fG5PMDNScIiUkHhYOTZVdIyUhGxOLy9NbISkkHpcVFRYeJCggWhLLCtKaIGflHxpdHRreJCcgWVHKCZEZH+a"
+    "lHx0iox4fJGYf2FDJCFAYH+WmH98kZV/fJSUfF9AIB09XHyRmH9/mJqBfJSQeFs8HBk5WHiNnIGBiIyEf5iMdFc4GBU1VHSInIGI"
+    "hIiMf5iIcVM0FBExUHCEnIGPgYSRf5iEbk8wEA0sTGuBnIGUgX+Yf5iBakssDAkoSGh/nJCUfH+VlJyBZkgoCQUkRGN/mKSMeHiQ"
+    "pJh/Y0QkBQEgQF98hISEcHSEhIR8YEAhAQEaOFRqbGxsY2NsbGxqVDgaAQEOKD5LTExMSEhMTExLPigOAQEBESMsLS0tKiotLS0s"
+    "IxEBAQggMzw9PT05Kig4PT09PDMgCBg0TVxcXFxWQT9UXFxcXE00GCBAX3p8fHxuU09rfHx8el9AIB8+XHaKlJF8YVx4jZSKdlw+"
+    "HxUwTGZ/lZ+EcWp/mpaBaEwwFQUhPFhzhqGSf3aMooZ0WDwhBQERLEhjf5KfhH+Ykn9lSC4RAQEBHDhUb4SdkoqfhHFVOh4CAQEB"
+    "DihFX3yNqqWPfGFGKg4BAQEBCidDXnqMqaiKdlxAJQkBAQEBGjZRboGbj5WagWtPNRoBAQEPKkZhfI+bgYaijXxgRSkOAQMeOlVx"
+    "hJ+Nen+VnYRvVToeAxMuSmV/kpuBbnOEoZJ/ZUkuEyE+WnSIoo16XmN/kqKGdFo+IShIaH+EhIFrT1VxhISEgWhIKCVDXmxsbGxb"
+    "QUVebGxsbF5DJRgxRUxMTExDLjFFTExMTEUxGAQZKC0tLS0mFhkoLS0tLSgZBA4lNj09PT01IyAzPD09PTgoER87UlxcXFxPODVN"
+    "XFxcXFQ+IyhIZnx8fHxjR0Nhenx8fGpLLCdGY3+SlIRvU09ugZSUf2VIKhw4VXOGopB8X1x6jaKGc1Y6Hg8sSGV/lZyBa2h/mpV/"
+    "ZUgsDwEeOlZzhqKMeHSIooZzVjoeAQEPLEhlf5WYf3+VlX9lSCwPAQEBHjpWc4aihoShiHRYOh4BAQEBDyxIZX+Wl5WWgWZKLhEB"
+    "AQEBAR88WHSIpKSIdFg8HwMBAQEBAREuSmZ/nJyBZkouEQEBAQEBAQUlRGR/nJyBZEQlBQEBAQEBAQUlRGR/nJyBZEQlBQEBAQEB"
+    "AQUlRGR/nJyBZEQlBQEBAQEBAQUlRGR/hISBZEQlBQEBAQEBAQIhP1tsbGxsWz8hAgEBAQEBAQEULkNMTExMQy4UAQEBAQEBAQEB"
+    "FiYtLS0tJhYBAQEBAQUdMTw9PT09PT09PT05KhQVMUpbXFxcXFxcXFxcVkEnHDxbdnx8fHx8fHx8fG5PMB09XHyUlJSUlJSUlIhw"
+    "UDEdPVx8lJSUlJSWrKCGcFAxHDxbdnx8fHx8hqSPfGNIKxUxSltcXFxugZqWgWtRNh0FHTE8PUxmf5KdhHNYPyUKAQUVK0VeeIqj"
+    "jHpgRy0SAQEJIz1YcYSblYFpTzQaAwECGzVPaX+Vm4FxVjwtKx8MEy5HYXyMo4p4XkxMTEo5IiU/WnSEn5J/bGxsbGxmTjAvTmt/"
+    "l6mMhISEhISEdFQ1MVBwiKSkpKSkpKSkjHRUNTFQcISEhISEhISEhIR0VDUtSmNsbGxsbGxsbGxsZk4wHjZITExMTExMTExMTEo5"
+    "IgkdKi0tLS0tLS0tLS0rHwwaMD5AQEBAQEA+MBosR1xgYGBgYGBcRyw0VHN/f39/f39zVDQ1VHSMmJCQkIx0VDU1VHSMlHx4eHhu"
+    "UjM1VHSMlHxcWFhVQSg1VHSMlHxcPTk2KRU1VHSMlHxcPR0XDgE1VHSMlHxcPR0BAQE1VHSMlHxcPR0BAQE1VHSMlHxcPR0BAQE1"
+    "VHSMlHxcPR0BAQE1VHSMlHxcPR0BAQE1VHSMlHxcPR0BAQE1VHSMlHxcPR0MAwE1VHSMlHxcPS0rHww1VHSMlHxcTExKOSI1VHSM"
+    "lHxsbGxmTjA1VHSMloSEhIR0VDU1VHSEhISEhIR0VDUwTmZsbGxsbGxmTjAiOUpMTExMTExKOSIMHystLS0tLS0rHwwLIzZAQEA9"
+    "LRcBAQEBAQEBHDhPYGBgWkQqDgEBAQEBASREY3x/f3FVNhoBAQEBAQEiQV98kJF8YEIlBwEBAQEBGDVTcYScgWtNLxIBAQEBAQ0q"
+    "SGZ/mIp2WDwdAQEBAQECHz1beIyWf2RHKQsBAQEBARUyT2yBn4RvUTQXAQEBAQEIJkRhf5SPel4/IQQBAQEBARs5VnSImoFoSy0P"
+    "AQEBAQEQLktogZqIc1Y4GgEBAQEBBCM/XnyPknxhQyYIAQEBAQEXNVJwhJ2BbE4xFAEBAQEBDCpHZX+WjHhaPB8BAQEBAQEePFp2"
+    "jJZ/ZUgqDAEBAQEBEzBOa4GdhHBTNRcBAQEBAQglQ2B8kpB8XkEjBgEBAQEBGjhVc4ibgWpMLhEBAQEBAQ8tSmh/moh0VzkcAQEB"
+    "AQEDIT9ceoyMf2NEJAEBAQEBARYzUWt0dHRfQiMBAQEBAQEKJj9RVFRUSTMYAQEBAQEBARImMzU1NS4dBhowPkBAQEBAQD4wGixH"
+    "XGBgYGBgYFxHLDRUc39/f39/f3NUNDVUdIyQkJCYjHRUNTNSbnh4eHyUjHRUNShBVVhYXHyUjHRUNRUpNjk9XHyUjHRUNQEOFx09"
+    "XHyUjHRUNQEBAR09XHyUjHRUNQEBAR09XHyUjHRUNQEBAR09XHyUjHRUNQEBAR09XHyUjHRUNQEBAR09XHyUjHRUNQEBAR09XHyU"
+    "jHRUNQEDDB09XHyUjHRUNQwfKy09XHyUjHRUNSI5SkxMXHyUjHRUNTBOZmxsbHyUjHRUNTVUdISEhISWjHRUNTVUdISEhISEhHRU"
+    "NTBOZmxsbGxsbGZOMCI5SkxMTExMTEo5IgwfKy0tLS0tLSsfDAEBAQ4fKCkpKB8OAQEBAQEMJTtISEhIOyUMAQEBARg2UmZoaGZS"
+    "NhgBAQEHJUJffIGBfF9CJQcBARMwTmuBnJyBa04wEwEBHjxadoyVlYx2WjweAQwqR2V/loSEln9lRyoMGDVTcISYgX+YhHBTNRgk"
+    "QV98kI96eo+QfF9BJC9MaoGbhG9vhJuBakwvOlh0ipR/ZWV/lIp0WDo8W3Z8fHRaWnR8fHZbPDFKW1xcWkdHWlxcW0oxHTE8PT07"
+    "Ly87PT08MR0RKDg9PT09PT09PT09OSoUIz5UXFxcXFxcXFxcXFZBJyxLanx8fHx8fHx8fHxuTzAtTGyElJSUlJSUlJSIcFAxLUxs"
+    "hIyMjIyMjIyMiHBQMStKZnR0dHR0dHR0dHRpTS8fOU5UVFRUVFRUVFRUTzwjDCIwNTU1NTU1NTU1NTIkDwEBFSo6QDooEgEBAQEV"
+    "K0FWYFU/Jw8BARIrQVhuf2tTPCMLASA+WG5/kX9pTzggBiVEZH+PpYx8Y0wzGB88VWt/jKGKeF9CIxAoP1JofIqMfGNEJAESJjxP"
+    "Y3p8Zk84HAEBDyM4TV9jTzkjCwEBAQsgM0JEOCMMAQEBAQEHGCMkHAsBAQEDEyAtNT1AQEA5Lh8OAQEDGi8+SlRcYGBfV0o7JQ8B"
+    "FTBHWmZzfH9/fHRmUjwkCR8+XHR/iJCWmJSIf2lPNRggP156jJqQjI2apI18X0EjFzNPaoGBenR4gZubgWhIKg4oP1tvcXh/f3+V"
+    "ooRsTC0cOFRrf4aQlZSUoKSEbEwtKEZjf5KdhoF8fJSkhGxMLS1MbISgkHplZnyUpIRsTC0tTGyEoJV/fH+KnaSEbEwtKEdlf5Kk"
+    "mJSYioqkhGxMLR46VW5/iIyIgXaEhIRsTC0PKEFWZnF0cWhgbGxsYEcpARUqPEpTVFNLR0xMTEczGwEBEB8tNDU0LSktLS0pGwYL"
+    "IzU9PT08MyAIAQEBAQEBHDhPXFxcXE00GAEBAQEBASREY3x8fHpfQCABAQEBAQElRGR/lJR/YEAhHhYKAQEBJURkf5yYf2BAQD00"
+    "JhQBASVEZH+cmH9gYGBcUUArFQElRGR/nJh/dn9/emtYQSoPJURkf5yYf4qUmI+BblY6HiVEZH+copSPjJWolX9lSColRGR/nJ2E"
+    "fHR/lqKEcFIzJURkf5yYf2BYdoyrjHZYOCVEZH+cmH9gUXCIqJB4WDklRGR/nJh/YFR0iKiNeFg5JURkf5yYf2ZkfJCliHNUNCVE"
+    "ZH+cn4h/f4qgmIFoSy0lRGR/nI+KmJihmoZ0Wj4hJURkf4SEeoGMiIF2YEkvEyE/W2xsbGBudHRrXUozHQMULkNMTExHT1RUTUEw"
+    "HQYBARYmLS0tKTA1NS8lFgQBAQEBAQ4eKzU9QEA+NiweDgEBARInOkhTXGBgXFVIOiUPAREoP1NlcXx/f3xzZVI8IQgkPVVrf4aQ"
+    "lpiRhn9oSywWM09pf5GimI2MkZWBaEssID5ceo2mkoF4dHyBb1Y9ISdGZH+YnYFuWlZhbFtEKhEpSGiBoJh/Y0Q3RUxDLhcBKUho"
+    "gZ2YgWVIQ09cVkEoDiVEZH+WooZ0ZWFrem5UOR4dPFp2iKKahn9/gYx/ZUotEy9KZXyKm6GYmJyWhnBQMQQeOU9meIGIjIyEgXRg"
+    "SCsBDCM5TF5ocHR0b2ZYSTMcAQEMITJBS1FUVFBIPC4dBgEBAQYXIy0zNTUwKh8RAwEBAQEBAQEFHTE8PT09NiUOAQEBAQEBFTFK"
+    "W1xcXFI7HwEBAQEBARw8W3Z8fHxmSCgBAQEDERohPVx8lJSBaEgpAQEMHi45QEBcfJSggWhIKQEMIzlKV2BgXHyUoIFoSCkHITlP"
+    "ZXR8f3p8lKCBaEgpFzNNZnyIlJiPgZSggWhIKSRBXnqKopqNjJaioIFoSCkuTGqBm5uEeHaBlqCBaEgpM1JwiKaQfF5cfJSggWhI"
+    "KTVUdIysjHRWXHyUoIFoSCk1VHSMqox4WFx8lKCBaEgpMlBwhqSSf2VmfJSggWhIKStKaH+YoYp/f4qgoIFoSCkhPlp2hpuimJiM"
+    "j6CBaEgpEy9KYHaBiIyEeoSEgWhIKQQdM0pea3R0bmBsbGxeQyUBBh0yQU5UVE9HTExMRTEYAQEGFyUvNTUwKS0tLSgZBAEBAxQl"
+    "MjtAQEA5Lh8OAQEBBBovQE9aYGBfV0o6JQ8BARkxR1treH9/fHRmUjwkCQ8sRV50f4yUmJSIf2lPNRoeOlZxhJiajIiNoI18YUQm"
+    "KUdlf5WbhHZwfIyfgWxOLy9ObIShkHx8fHyBoIh0VDUxUHCIqJ2UlJSUlaSMdFQ1MVBwiKWShISEhISEhHFTNC1Ma4GdlX9sbGxs"
+    "cGxjSi0lQ2B8j6OMf3x8f4ZzVjwfGjZRa3+PnZqUlJiVf2ZIKAolP1VrfIGIjIiEf3RgRCYBEig/UWFrc3R0bmVYSDMaAQESJTZD"
+    "TVRUVE9HPC4cBgEBAQoaJS80NTUwKR4RAgEBAQEBAQgWHiQlJSEaEgUBAQEBARIlMz1ERERAOS8fCQEBARQrP09cY2RkYFhLNhwB"
+    "AQwnQFhren9/f3x2Y0YnBBIaNlNrf42YnJqUgWhIKR0vOENhfJGolYiIjH9hQyQySlhYaIGdmoF0cHZ0WjscP152eHiEpJR8eHh4"
+    "ZUcvE0Bgf5CQkqqdkJCQgWhIKQlAYH+QkJKqnZCQkIFoSCkJP152eHiEpJR8eHh4ZUcoCDJKWFhshKSUfFxYWE85HgEdLzhMbISk"
+    "lHxcPTkzIgwBBBItTGyEpJR8XD0dFQgBAQENLUxshKSUfFw9HQEBAQEBDS1MbISklHxcPR0BAQEBAQ0tTGyEpJR8XD0dAQEBAQEN"
+    "LUxshISEfFw9HQEBAQEBCilHYGxsbGpUOBoBAQEBAQEbM0dMTExLPigOAQEBAQEBBhspLS0tLCMRAQEBAQEBAQ4fLjlAQEA6OTk5"
+    "OC4aAQ8lO0pXX2BgWFhYWFdHLwolPFJmdHx/f3h4eHh0WjsYNVFpf4iUmJSQkJCQfFw9I0JffI+hjIGGmp2MjHxcPSlIaH+cknxq"
+    "doybgXRxWDopSGiBn5B4W3GIpIRsU0QtJkRjf5WYgXh/kpqBaEorFxw6Vm+BmJiQlZWEdlw/IwQhP1x2io2BgYF/c2BKOigSJURk"
+    "f5qIenR0dHRuZVQ/JSREY3+VnY+MjIyIhH9rUTUnQ1txf5aQlJSUmqGPfF4/M1FugZaBfHx8fIGamH9gQDVUdIyYgXZwcHiBmo98"
+    "XD4zUW+EmJaMiIiMmI+Ba1E1KEVedIGEjIyKhoF8a1U/JRkxR1pocHR0dHBoX1E/KBIEGi8+SlBUVFRQS0E1JRIBAQMTISsxNTU1"
+    "MSwjGAoBAQsjNT09PT01IwsBAQEBAQEcOE9cXFxcTzgcAQEBAQEBJERjfHx8fGNEJAUBAQEBASVEZH+UlIFkRCUhGhECAQElRGR/"
+    "nJyBZERAQDkuHAYBJURkf5ycgWReYGBXSDMdBCVEZH+cm4FxfH98dGBKMBUlRGR/nJh/hJGYlIZ2XD8hJURkf5ybiJWQlquagWhK"
+    "KyVEZH+co4x/eIGYpIRvUDAlRGR/nJyBZlt4kKiIcFAxJURkf5ycgWRYeJCoiHBQMSVEZH+cnIFkWHiQqIhwUDElRGR/nJyBZFh4"
+    "kKiIcFAxJURkf5ycgWRYeJCoiHBQMSVEZH+cnIFkWHiQpIhwUDElRGR/hISBZFh4hISEcFAxIT9bbGxsbFtRaGxsbGNKLRQuQ0xM"
+    "TExDPEtMTExINh4BFiYtLS0tJiEsLS0tKh0JAQEBBBouOkBAOSwXAQEBARkxR1hgYFZELhYBAQsoRV50f39xW0ElAQETM1FvhJWU"
+    "gWtNLwQSGTVUdIyrqIhwUDEdLzg5UW6BkZCBak0vMkpYWFhbcXx8blg/Iz9ednh4eHh4eHhlRyhAYH+QkJCQkJCBaEgpQGB/kJCQ"
+    "kKCggWhIKT9ednh4eH+YoIFoSCkySlhYWGB/mKCBaEgpHS84OUBgf5iggWhIKQQSGSFAYH+YoIFoSCkBAQEhQGB/mKCBaEgpAQEB"
+    "IUBgf5iggWhIKQEBASFAYH+YoIFoSCkBAQEhQGB/hISBaEgpAQEBHTxYa2xsbF5DJQEBARErQExMTExFMRgBAQEBFCUsLS0tKBkE"
+    "AQEBAQQaLjpAQDksFwEBAQEBGTFHWGBgVkQuFgEBAQsoRV50f39xW0ElAQEBEzNRb4SVlIFrTS8BBBIZNVR0jKuoiHBQMQYdLzg5"
+    "UW6BkZCBak0vFzJKWFhYW3F8fG5YPyMgP152eHh4eHh4eGVHKCFAYH+QkJCQkJCBaEgpIUBgf5CQkJCgoIFoSCkgP152eHh4f5ig"
+    "gWhIKRcySlhYWGB/mKCBaEgpBh0vODlAYH+YoIFoSCkBBBIZIUBgf5iggWhIKQEBAQEhQGB/mKCBaEgpAQIRGCFAYH+YoIFoSCkD"
+    "Gi44NUBgf5iggWhIKRUwR1dTS2B/mKCBaEgpIT5cdHBobH+cmIFkRicuS2h/hIGEkqiNel4/IDdWdIiaoKCaj4FrTzMXNlVufIGB"
+    "gYF8a1U/JQgpQVNeZGhoZF5RPygSARUoNT9GSEhGPzUlEgEBAQwXIScpKSchFwoBAQELIzU9PT09NSMLAQEBAQEBARw4T1xcXFxP"
+    "OBwBAQEBAQEBJERjfHx8fGNEJAUBAQEBAQElRGR/lJSBZEQlGRkZGRIEASVEZH+cnIFkRDU5OTk4Lx0GJURkf5ycgWREU1hYWFhK"
+    "MhclRGR/nJyBZFNreHh4dl4/ICVEZH+cnIFkaX+QkIR0XD4fJURkf5ycgWZ/j52Gdl9HMBUlRGR/nJyBfIyfhnZgSjMaAyVEZH+c"
+    "nIGKoop6YUozHQYBJURkf5yjkKCmjHpfRiwRAQElRGR/nLmijI+dhHFYPiQJASVEZH+cpIx8gZeVf2pPNRwCJURkf5ycgWZ0hqGN"
+    "fGFILhQlRGR/nJyBZGN8j5+GdFpAJSVEZH+EhIFkUmuBhISBa0wsIT9bbGxsbFtAW2xsbGxgRykULkNMTExMQy5DTExMTEczGwEW"
+    "Ji0tLS0mFiYtLS0tKRsGFy06PT09PT09Oy8aAgEBASpEWFxcXFxcXFpHLhEBAQE0U3F8fHx8fHx0VzgYAQEBNVR0jJSUlJSQeFg5"
+    "GQEBATVUdIyQkJWtkHhYORkBAQEzUm54eHiIqJB4WDkZAQEBKEFVWFhwiKiQeFg5GQEBARUpNjlQcIiokHhYORkBAQEBDhcxUHCI"
+    "qJB4WDkZAQEBAQERMVBwiKiQeFg5GQEBAQEBETFQcIiokHhYORkDAQEBARExUHCIqJB4WDkoIREBAQERMVBwiKiQeFhHSD0oDwEB"
+    "ETFQcIilkHpjZWhVOhwBAQ4tTGuBnZuEf39/Y0QlAQEHJUNhfI+hn5iYgWtNLwEBARo1UWl/hIyMiIFwUDEBAQEKJTxSY290dHBq"
+    "XUYqAQEBAQ8lOEdQVFRRS0EwGgEBAQEBDRwpMjU1My0kFgQaLjg5OTZAQD02QEA8Lx0GAS9HV1hYVV9gWlNfYFpKMx0DO1p0eHhu"
+    "fH92bnx/dmBJLhE9XHyQjH+RmIR/kZaGdFg6HD1cfJSVjJCdko+RopV/YUMkPVx8lKGEeoyagX+UnIFkRCU9XHyUnIF0jJR8fJSc"
+    "gWREJT1cfJScgXSMlHx8lJyBZEQlPVx8lJyBdIyUfHyUnIFkRCU9XHyUnIF0jJR8fJScgWREJT1cfJScgXSMlHx8lJyBZEQlPVx8"
+    "lJyBdIyUfHyUnIFkRCU9XHyEhIF0hIR8fISEgWREJThUamxsbGZsbGpqbGxsWz8hKD5LTExMSkxMS0tMTExDLhQRIywtLS0rLS0s"
+    "LC0tLSYWAQkgMTk5OTY2P0BAOSwcBgEaNUxYWFhVVV5gYFZIMx0EJENheHh4bnF8f3xzYEowFSVEZH+QjHqEkZiUhnZcPyElRGR/"
+    "nJWKlZCWq5qBaEorJURkf5yjjH94gZikhG9QMCVEZH+cnIFmW3iQqIhwUDElRGR/nJyBZFh4kKiIcFAxJURkf5ycgWRYeJCoiHBQ"
+    "MSVEZH+cnIFkWHiQqIhwUDElRGR/nJyBZFh4kKiIcFAxJURkf5ycgWRYeJCkiHBQMSVEZH+EhIFkWHiEhIRwUDEhP1tsbGxsW1Fo"
+    "bGxsY0otFC5DTExMTEM8S0xMTEg2HgEWJi0tLS0mISwtLS0qHQkBAQYYJzQ8QEA9NSgaCAEBAQYdMkNRXGBgXFNFNCAJAQQdM0pe"
+    "bnp/f3xvYE02IAcVMEpgdoGPlpiQhHpjTTMYIz9cdoabmoyMl52Kel9DJi1LaH+am4F4doGYnYFsTjAzUnCIpZB8Xlt4jKmMdFY3"
+    "NVR0jKyMdFZScIiokHhYOTVUdIypjHhYVHSIqI94WDkwUG+EoZR/ZmR8kKWIc1Q0KUdlf5Kiin9/hqCWgWhLLR46VW6BkqGYmKGV"
+    "gXFYPSEOKUFYbn+EjIyEgXFbRC0RARUrQVVkb3R0cGVWRC4XAQEBFSk6R1BUVFBIPCwXAQEBAQEOHSkwNTUyKh8QAQEBCSAxOTk5"
+    "NTpAQD00JxQBARo1TFhYWFNYYGBcUUErFQEkQ2F4eHhrdn9/em5YQSoQJURkf5CMf4qUmI+BblY8HyVEZH+cmpKPjJWolX9mSCsl"
+    "RGR/nJ2EfHR/lqKGcFIzJURkf5ycgWRYdIyqjHhYOSVEZH+cnIFkUHCIqJB4WDklRGR/nJyBZFV0iqiNeFg5JURkf5ycgWpofJGl"
+    "iHFTNCVEZH+co4yBf4yiloFoSy0lRGR/nJuImpykl4RzWD4hJURkf5yYf4GIhIF0XkctEiVEZH+cmH9qcHBoWkcxGgElRGR/nJh/"
+    "YFBQSj4uGgQBJURkf5iYf2BAMSshEwIBASVEZH9/f3xgQCEMAwEBAQEdOlJgYGBgTzYaAQEBAQEBDiU4QEBAQDYjCgEBAQEBAQEB"
+    "DB4uOUBAPTQ5OTkzIgwBDCM5SldgYFxRWFhYTzkeByI5T2V0f396a3h4eGVHKBczTmZ8iJSYj4GIkIFoSCkkQV56jKKajIyVl6CB"
+    "aEgpLkxqgZubhHh4gZiggWhIKTRTcYimkHpeYH+YoIFoSCk1VHSMrIx0VWB/mKCBaEgpNVR0jKmMeFhgf5iggWhIKTFQcISklH9o"
+    "an+YoIFoSCkrSmZ/l6KMf4GNo6CBaEgpID5adISYpJyahpaggWhIKRMuR2B0gYaIgXyUoIFoSCkCGzNIW2hwcGp/mKCBaEgpAQYc"
+    "Lz9LUFBgf5iggWhIKQEBAxQjLDFAYH+YmIFoSCkBAQEBBA0hQGB8f39/aEgoAQEBAQEBGjZPYGBgYFU9IQEBAQEBAQojNkBAQEA6"
+    "KBEMIjM5OTk1MTtAQD41JxIeOU9YWFhTTlpgYFxTPyYoR2V4eHhranh/f3xrUTMpSGiBkIhwf4yVmIp0VDUpSGiBoIx/lZiUlIRs"
+    "Ti8pSGiBoJWPioF8fIFlRygpSGiBoKWMemheYGRVPB8pSGiBoJiBaE4/QUQ8KBApSGiBoJh/YEAiIiUfEAEpSGiBoJh/YEAhAwUB"
+    "AQEpSGiBoJh/YEAhAQEBAQEpSGiBoJh/YEAhAQEBAQEpSGiBhIR/YEAhAQEBAQElQ15sbGxrWDwdAQEBAQEYMUVMTExMQCsRAQEB"
+    "AQEEGSgtLS0sJRQBAQEBAQEBAQweLDY9QEA/OS8jFQYBAQwjOUhVXGBgXldNPzEgCQciOU9lc3x/f3x0alxMNRoVMU5mfIaRmJiU"
+    "ioF4YUMkHj1beIyij4SEipSMel9CIyFAYH+YnIFubnR/f2ZONBghQGB8kqSNhH98dGhYQSsRGjhVb4GRnKCYkYh/blg8Hw4pRFtu"
+    "fIGIjZillX9mSCofOVNufG5qcHh/kqKEbEwtL0tlf4+Bf3p4f5KdgWtMLDVUdISSnZWQkJWbinpfQyUuSWBxfIGIjIyIgXpjTTQY"
+    "HTNHVWFrcHR0cGpeTTYgCAYbKjhDTFJUVFFLQTMgCQEBAQ4aJS4zNTUzLSQXBwEBAQEBFSk2OTk5MSAJAQEBAQEBDChBVVhYWEw1"
+    "GgEBAQEBDhczUm54eHhhQyQZFQgBFSk2OVh2jJCBZEQ5OTMiDChBVVhcfJCcgWRYWFhPOR4zUm54eH+UnIF4eHh4ZUcoNVR0jJCQ"
+    "oKOQkJCQgWhIKTVUdIyQkKOjkJCQkIFoSCkzUm54eH+cnIF4eHh4ZUcoKEFVWGR/nJyBZFhYWE85HhUpNkRkf5ycgWREOTkzIgwB"
+    "DiVEZH+cnIFkRENIPysSAQUlRGR/mJyBalxhaFg+IQEBIEBffJGojH98f4FoSCkBARg2VXGEmqSYlJaEbk8wAQEOKkZedIGIjIyG"
+    "gXRUNQEBARoxR1xqcXR0cGpfSS4BAQEEGjA/TFNUVFBLQzMdAQEBAQMVIy40NTUyLCUYBg8lNDk5OTguMTk5OTkxIAkhPFFYWFhX"
+    "R0xYWFhYTDUaLEtoeHh4dFpheHh4eGFDJC1MbISQkHxcZH+QkIFkRCUtTGyEpJR8XGR/nJyBZEQlLUxshKSUfFxkf5ycgWREJS1M"
+    "bISklHxcZH+cnIFkRCUtTGyEpJR8XGR/nJyBZEQlLUxshKSUfFxkf5ycgWREJS1MbISklX9lbn+cnIFkRCUrSmiBnKGGf4GVoJyB"
+    "ZEQlJEJgfJGlopyVgZCcgWREJRo2U2t/iIyGgXSEhIFkRCUMJz9VaHF0cGZmbGxsWz8hARIoPUtTVFJKSkxMTEMuFAEBESEtNDUz"
+    "KystLS0mFgEdLzg5OTkzIiAxOTk5OC8dMkpYWFhYTzk1TFhYWFhKMj9ednh4eGVHQ2F4eHh2Xj8+XHqPkIRvUU1rgZCPelw+NFFv"
+    "hKGNeFxXdIqhhG9SNClHZH+WmIFmYX+Uln9lRykdPFh2iqKEcGuBnYx4WjweEi9Na4Gcj3p0ip2BbE4xFAclQmB8kZh/fJSUf2FD"
+    "JggBGjZVc4aghIGciHRWORsBAQ8sSmh/mIyGm4FoTC4QAQEDIT5ceI2hn5B8X0EjBQEBARUzUW6EhISEcVM1GAEBAQEKKEVebGxs"
+    "bGBHKg0BAQEBARkxRUxMTExHMxsBAQEBAQEEGSgtLS0tKRsGAQEBEic1OTk5NScSESU0OTk5NScSJT9TWFhYUz8xMTxRWFhYUz8l"
+    "L05reHh4a1FQUE5peHh4a04vMVBwhJCMdGlwcGtwiJCGcFAxLEtqgaCQeHiIiHx0jKCBa0wsJ0Zkf5uUfHyUmH94kJyBZkgoIkFg"
+    "f5WYf3+MjIF8lJh/YEIjHTxcepCcgYGIiIR/mJF8XD0eGDdWdIyggYSEhIx/nIx4WDkZEzJQcIakhIqBgZB/nIhxUzQUDSxMa4Gg"
+    "jI+Bf5WEoIRsTi8QCChHZX+bpJR8fJSgnYFoSCoLAyJBYH+EhIR4eISEhIFkRCUGARw6VWpsbGxoaGxsbGtYPB8BAQ8oPktMTExL"
+    "S0xMTExAKxEBAQERIywtLS0sLC0tLSwlFAEBFSk2OTk5NywsNzk5OTYpFShBVVhYWFZERFZYWFhVQSgzUm54eHhxWlZxeHh4blIz"
+    "M1FugZCQgWpmf5CQgW5RMydBXHaGoY18dIijinZdQScWMEpjfI+dhH+Wkn9mSzEWBB04UmuBmJWMnYFvVTsfBQEMJkBbdIioqYx6"
+    "X0QpDwEBGTNOaH+VmqCNfGNJMBYBECpFX3qMm4GMoIZ0XEEoDiI8VnGEnY16f5WagW5UOyEzTmh/lZiBa3GEnZJ/Zk0zPFx6hISE"
+    "dltgeoSEhHpcPDhUamxsbGNKTmZsbGxqVDgoPktMTExINjlKTExMSz4oESMsLS0tKh0fKy0tLSwjER0vODk5OTMiHS84OTk4Lx0y"
+    "SlhYWFhPOTJKWFhYWEoyP152eHh4ZUdBXnZ4eHZePz5ceI2QhG9STGh/kI98Xj8zT2uBnY98XlZ0iKGEb1I1JUNffI+bgWpgfJKW"
+    "f2RHKRg1Um+En4p0aoGcinZYPB0MKEVjf5KVf3SIm4FqTS8SARw4VXOGn4R8kpB8X0EkBgEPLEhlf5aMf5uEcVM1GAEBAR48WHSI"
+    "l4+WgWVIKg0BARIlL0xof5iojHZaPB8BAQwnP05OXHiQnYFrTjATAQEYNlNrbHF/mpF8X0MlBwEBID9efISIlZuBb1M2GAEBASdG"
+    "ZH+YnZaGdl5EKAwBAQEpSGiBgYF/dGBKMhgBAQEBIz9YZGhoZFhIMx0GAQEBARMrPkZISEQ8LhwGAQEBAQEBEiAnKSklHRECAQEB"
+    "AQEBARUpNjk5OTk5OTk5OTMiDAwoQVVYWFhYWFhYWFhPOR4UM1JueHh4eHh4eHh4ZUcoFTVUdIyQkJCQkJCQgWhIKRU1VHSMkJCQ"
+    "kKOulYFoSCkUM1JueHh4eISdmoFxWD8jDChBVVhYboGXnYR0XEQrEwEVKTxSa3+VoIh2YEcwFwEGIDhPaH+Po4x8Y0pEPy4WGjNM"
+    "Y3yMpY9/ZmRkZFtDJiZEYHiKoZyBf39/f39sTC0pSGiBnaSknJycnJyEbEwtKUhogYSEhISEhISEhGxMLSVDXmxsbGxsbGxsbGxg"
+    "RykYMUVMTExMTExMTExMRzMbBBkoLS0tLS0tLS0tLSkbBgEBAQQZKDU9QEBAPS0XAQEBGjFFU1xgYGBaRCgBAQ8sRl5vfH9/f29Q"
+    "MAEBGjhWcYSQlZCIcFAxAQEgQF98kpWBeHhrTi8BASFAYH+YkHhaWFM/JQEBIUBgf5iQeFg5NScSCRwnPVx8lJB4WDkZDAEfNkZI"
+    "W3iQkHhYORkBAS9LY2hvf5SNeFg5GQEBNVR0gYSPj4FuUTMVAQE1VHSMlJWBfGZMLxEBATNSbnh8hJqKdFY3GAEBKEFVWGB6kJB4"
+    "WDkZAQEVKTY9XHySkHhYORkBAQEOIUBgfJSQeFg5Kh0JAQEhQGB/mJB4WExINh4BASFAYH+WkXxsbGNKLQEBHTxbeIqbioSEcFAx"
+    "AQEVMUxmeoGEhIRwUDEBAQYhOU9eaGxsbGNKLQEBAQwiM0FITExMSDYeAQEBAQgXIyktLS0qHQkaLjg5OTgvHS9HV1hYWEoyO1p0"
+    "eHh2Xj89XHyQkH9gQD1cfJSYf2BAPVx8lJh/YEA9XHyUmH9gQD1cfJSYf2BAPVx8lJh/YEA9XHyUmH9gQD1cfJSYf2BAPVx8lJh/"
+    "YEA9XHyUmH9gQD1cfJSYf2BAPVx8lJh/YEA9XHyUmH9gQD1cfJSYf2BAPVx8lJh/YEA9XHyUmH9gQD1cfJSYf2BAPVx8lJh/YEA9"
+    "XHyUmH9gQD1cfISEf2BAOFRqbGxrWDwoPktMTExAKxEjLC0tLCUUGjA+QEBAPDUoGAQBAQEsR1xgYGBcU0QxGgEBATRUc39/f3pv"
+    "XkYsDwEBNVR0jJCWkIFxVjgaAQEzUm54eH+VknxfQCABAShBVVhaeJCYf2BAIQEBFSk2OVh4kJh/YEAhAQEBDhk5WHiQlHxcPSYa"
+    "BgEBGTlYeJCQeFpIRDMcAQEZOVh4jZR/b2hgSCsBARUzUW6Bj4+EgXBQMQEBES9MZnyBlZSIcFAxAQEYN1Z0ipqEfHhrTi8BARk5"
+    "WHiQkHhgWFM/JQEDGTlYeJCRfFw9NScSDB8rOVh4kJR8YEAhDAEiOUpMWHiQmH9gQCEBATBOZmxsfJGWf2BAIQEBNVR0hISKm4p4"
+    "WjwdAQE1VHSEhISBemZMMRQBATBOZmxsbGheTzkhBgEBIjlKTExMSEEzIgwBAQEMHystLS0pIxcIAQEBAQEBBBMgKCkmHB0qLCUX"
+    "CAEBBh0vPkhIRDg2SExBMyQPBB0zSlpmaGNVSmNrXk88IxUwSmB2f4F/bl1zgXppTS8jP1x2hpickoF6f5WEb1AwL01qf5qGgYqa"
+    "kJaPfGFHKTBQb4GKeGh6gYyGf2lRNhsoRFpodmtOX250cWVSPCUKFy0+TFhTP0NPVFNIOiUPAQETIS84NScnMjU0Kx4OAQE=";
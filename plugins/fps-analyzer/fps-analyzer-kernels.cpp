@@ -0,0 +1,633 @@
+#include "fps-analyzer-kernels.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define FA_ARCH_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define FA_TARGET(x)
+#else
+#include <cpuid.h>
+#define FA_TARGET(x) __attribute__((target(x)))
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)
+#define FA_ARCH_NEON 1
+#include <arm_neon.h>
+#endif
+
+// --- Scalar reference ---
+
+size_t fa_count_diff_bytes_scalar(const uint8_t *a, const uint8_t *b, size_t size) {
+    size_t diff = 0;
+    for (size_t i = 0; i < size; ++i) {
+        if (a[i] != b[i]) ++diff;
+    }
+    return diff;
+}
+
+size_t fa_count_diff_copy_scalar(const uint8_t *src, const uint8_t *ref, uint8_t *dst, size_t size) {
+    size_t diff = 0;
+    for (size_t i = 0; i < size; ++i) {
+        uint8_t v = src[i];
+        if (v != ref[i]) ++diff;
+        dst[i] = v;
+    }
+    return diff;
+}
+
+void fa_bgra_to_luma_scalar(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    for (uint32_t x = 0; x < width; ++x) {
+        uint8_t b = src[x * 4 + 0];
+        uint8_t g = src[x * 4 + 1];
+        uint8_t r = src[x * 4 + 2];
+        luma[x] = (uint8_t)((r * 66 + g * 129 + b * 25 + 128) >> 8) + 16;
+    }
+}
+
+void fa_rgba_to_luma_scalar(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    for (uint32_t x = 0; x < width; ++x) {
+        uint8_t r = src[x * 4 + 0];
+        uint8_t g = src[x * 4 + 1];
+        uint8_t b = src[x * 4 + 2];
+        luma[x] = (uint8_t)((r * 66 + g * 129 + b * 25 + 128) >> 8) + 16;
+    }
+}
+
+void fa_yuy2_to_luma_scalar(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    for (uint32_t x = 0; x < width; ++x) {
+        luma[x] = src[x * 2];
+    }
+}
+
+void fa_uyvy_to_luma_scalar(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    for (uint32_t x = 0; x < width; ++x) {
+        luma[x] = src[x * 2 + 1];
+    }
+}
+
+// --- x86 ---
+
+#ifdef FA_ARCH_X86
+
+// Byte counters are flushed every 255 blocks so they never wrap
+
+FA_TARGET("sse2")
+static size_t count_diff_bytes_sse2(const uint8_t *a, const uint8_t *b, size_t size) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t same = 0;
+    size_t i = 0;
+    while (size - i >= 16) {
+        size_t blocks = (size - i) / 16;
+        if (blocks > 255) blocks = 255;
+        __m128i acc = zero;
+        for (size_t n = 0; n < blocks; ++n, i += 16) {
+            __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+            __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+            acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(va, vb));
+        }
+        __m128i sums = _mm_sad_epu8(acc, zero);
+        same += (size_t)_mm_cvtsi128_si32(sums) + (size_t)_mm_extract_epi16(sums, 4);
+    }
+    return (i - same) + fa_count_diff_bytes_scalar(a + i, b + i, size - i);
+}
+
+FA_TARGET("sse2")
+static size_t count_diff_copy_sse2(const uint8_t *src, const uint8_t *ref, uint8_t *dst, size_t size) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t same = 0;
+    size_t i = 0;
+    while (size - i >= 16) {
+        size_t blocks = (size - i) / 16;
+        if (blocks > 255) blocks = 255;
+        __m128i acc = zero;
+        for (size_t n = 0; n < blocks; ++n, i += 16) {
+            __m128i vs = _mm_loadu_si128((const __m128i *)(src + i));
+            __m128i vr = _mm_loadu_si128((const __m128i *)(ref + i));
+            _mm_storeu_si128((__m128i *)(dst + i), vs);
+            acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(vs, vr));
+        }
+        __m128i sums = _mm_sad_epu8(acc, zero);
+        same += (size_t)_mm_cvtsi128_si32(sums) + (size_t)_mm_extract_epi16(sums, 4);
+    }
+    return (i - same) + fa_count_diff_copy_scalar(src + i, ref + i, dst + i, size - i);
+}
+
+FA_TARGET("avx2")
+static size_t count_diff_bytes_avx2(const uint8_t *a, const uint8_t *b, size_t size) {
+    const __m256i zero = _mm256_setzero_si256();
+    size_t same = 0;
+    size_t i = 0;
+    while (size - i >= 32) {
+        size_t blocks = (size - i) / 32;
+        if (blocks > 255) blocks = 255;
+        __m256i acc = zero;
+        for (size_t n = 0; n < blocks; ++n, i += 32) {
+            __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+            __m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+            acc = _mm256_sub_epi8(acc, _mm256_cmpeq_epi8(va, vb));
+        }
+        __m256i sums256 = _mm256_sad_epu8(acc, zero);
+        __m128i sums = _mm_add_epi64(_mm256_castsi256_si128(sums256),
+                                     _mm256_extracti128_si256(sums256, 1));
+        same += (size_t)_mm_cvtsi128_si32(sums) + (size_t)_mm_extract_epi16(sums, 4);
+    }
+    return (i - same) + fa_count_diff_bytes_scalar(a + i, b + i, size - i);
+}
+
+FA_TARGET("avx2")
+static size_t count_diff_copy_avx2(const uint8_t *src, const uint8_t *ref, uint8_t *dst, size_t size) {
+    const __m256i zero = _mm256_setzero_si256();
+    size_t same = 0;
+    size_t i = 0;
+    while (size - i >= 32) {
+        size_t blocks = (size - i) / 32;
+        if (blocks > 255) blocks = 255;
+        __m256i acc = zero;
+        for (size_t n = 0; n < blocks; ++n, i += 32) {
+            __m256i vs = _mm256_loadu_si256((const __m256i *)(src + i));
+            __m256i vr = _mm256_loadu_si256((const __m256i *)(ref + i));
+            _mm256_storeu_si256((__m256i *)(dst + i), vs);
+            acc = _mm256_sub_epi8(acc, _mm256_cmpeq_epi8(vs, vr));
+        }
+        __m256i sums256 = _mm256_sad_epu8(acc, zero);
+        __m128i sums = _mm_add_epi64(_mm256_castsi256_si128(sums256),
+                                     _mm256_extracti128_si256(sums256, 1));
+        same += (size_t)_mm_cvtsi128_si32(sums) + (size_t)_mm_extract_epi16(sums, 4);
+    }
+    return (i - same) + fa_count_diff_copy_scalar(src + i, ref + i, dst + i, size - i);
+}
+
+FA_TARGET("avx512f,avx512bw")
+static size_t count_diff_bytes_avx512(const uint8_t *a, const uint8_t *b, size_t size) {
+    const __m512i zero = _mm512_setzero_si512();
+    size_t diff = 0;
+    size_t i = 0;
+    while (size - i >= 64) {
+        size_t blocks = (size - i) / 64;
+        if (blocks > 255) blocks = 255;
+        __m512i acc = zero;
+        for (size_t n = 0; n < blocks; ++n, i += 64) {
+            __m512i va = _mm512_loadu_si512((const void *)(a + i));
+            __m512i vb = _mm512_loadu_si512((const void *)(b + i));
+            acc = _mm512_sub_epi8(acc, _mm512_movm_epi8(_mm512_cmpneq_epu8_mask(va, vb)));
+        }
+        alignas(64) uint64_t sums[8];
+        _mm512_store_si512((void *)sums, _mm512_sad_epu8(acc, zero));
+        for (int k = 0; k < 8; ++k) diff += (size_t)sums[k];
+    }
+    if (i < size) {
+        // Masked tail: lanes past the end load as zero in both inputs
+        __mmask64 tail = (__mmask64)(~0ULL >> (64 - (size - i)));
+        __m512i va = _mm512_maskz_loadu_epi8(tail, (const void *)(a + i));
+        __m512i vb = _mm512_maskz_loadu_epi8(tail, (const void *)(b + i));
+        uint64_t m = (uint64_t)_mm512_cmpneq_epu8_mask(va, vb);
+        while (m) {
+            m &= m - 1;
+            ++diff;
+        }
+    }
+    return diff;
+}
+
+FA_TARGET("avx512f,avx512bw")
+static size_t count_diff_copy_avx512(const uint8_t *src, const uint8_t *ref, uint8_t *dst, size_t size) {
+    const __m512i zero = _mm512_setzero_si512();
+    size_t diff = 0;
+    size_t i = 0;
+    while (size - i >= 64) {
+        size_t blocks = (size - i) / 64;
+        if (blocks > 255) blocks = 255;
+        __m512i acc = zero;
+        for (size_t n = 0; n < blocks; ++n, i += 64) {
+            __m512i vs = _mm512_loadu_si512((const void *)(src + i));
+            __m512i vr = _mm512_loadu_si512((const void *)(ref + i));
+            _mm512_storeu_si512((void *)(dst + i), vs);
+            acc = _mm512_sub_epi8(acc, _mm512_movm_epi8(_mm512_cmpneq_epu8_mask(vs, vr)));
+        }
+        alignas(64) uint64_t sums[8];
+        _mm512_store_si512((void *)sums, _mm512_sad_epu8(acc, zero));
+        for (int k = 0; k < 8; ++k) diff += (size_t)sums[k];
+    }
+    return diff + fa_count_diff_copy_scalar(src + i, ref + i, dst + i, size - i);
+}
+
+// RGB -> Y. Every partial sum of 66 R + 129 G + 25 B + 128 is below 65536,
+// so 16-bit lanes with wrapping adds and a logical shift give the exact
+// scalar result.
+
+// SSE2: split channels out of 32-bit pixels, 16 pixels per iteration.
+// RShift/BShift: bit position of R and B inside a little-endian pixel.
+template <int RShift, int BShift>
+FA_TARGET("sse2")
+static inline __m128i rgb_to_luma8_sse2(__m128i p0, __m128i p1) {
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    __m128i r = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, RShift), mask),
+                                _mm_and_si128(_mm_srli_epi32(p1, RShift), mask));
+    __m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 8), mask),
+                                _mm_and_si128(_mm_srli_epi32(p1, 8), mask));
+    __m128i b = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, BShift), mask),
+                                _mm_and_si128(_mm_srli_epi32(p1, BShift), mask));
+    __m128i y = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(66)),
+                              _mm_mullo_epi16(g, _mm_set1_epi16(129)));
+    y = _mm_add_epi16(y, _mm_mullo_epi16(b, _mm_set1_epi16(25)));
+    y = _mm_srli_epi16(_mm_add_epi16(y, _mm_set1_epi16(128)), 8);
+    return _mm_add_epi16(y, _mm_set1_epi16(16));
+}
+
+template <int RShift, int BShift>
+FA_TARGET("sse2")
+static void rgb_to_luma_sse2(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    uint32_t x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m128i *p = (const __m128i *)(src + (size_t)x * 4);
+        __m128i lo = rgb_to_luma8_sse2<RShift, BShift>(_mm_loadu_si128(p), _mm_loadu_si128(p + 1));
+        __m128i hi = rgb_to_luma8_sse2<RShift, BShift>(_mm_loadu_si128(p + 2), _mm_loadu_si128(p + 3));
+        _mm_storeu_si128((__m128i *)(luma + x), _mm_packus_epi16(lo, hi));
+    }
+    if (RShift == 16)
+        fa_bgra_to_luma_scalar(src + (size_t)x * 4, luma + x, width - x);
+    else
+        fa_rgba_to_luma_scalar(src + (size_t)x * 4, luma + x, width - x);
+}
+
+// AVX2: pmaddubsw on the interleaved bytes. 129 does not fit a signed 8-bit
+// coefficient, so G is weighted 62 + 67 across two multiply-adds; that keeps
+// each saturating pair sum (at most 255 * (66 + 62)) below 32768, and the
+// final add wraps harmlessly in 16 bits.
+// w1/w2 hold the per-byte weights for one pixel (little-endian order).
+FA_TARGET("avx2")
+static inline __m256i rgb_to_luma16_avx2(__m256i p0, __m256i p1, __m256i w1, __m256i w2) {
+    __m256i s0 = _mm256_add_epi16(_mm256_maddubs_epi16(p0, w1), _mm256_maddubs_epi16(p0, w2));
+    __m256i s1 = _mm256_add_epi16(_mm256_maddubs_epi16(p1, w1), _mm256_maddubs_epi16(p1, w2));
+    __m256i y = _mm256_hadd_epi16(s0, s1);
+    y = _mm256_srli_epi16(_mm256_add_epi16(y, _mm256_set1_epi16(128)), 8);
+    return _mm256_add_epi16(y, _mm256_set1_epi16(16));
+}
+
+FA_TARGET("avx2")
+static void rgb_to_luma_avx2(const uint8_t *src, uint8_t *luma, uint32_t width,
+                             int w_b0, int w_b2, bool bgra) {
+    // Byte weights per pixel: [w_b0, 62, w_b2, 0] + [0, 67, 0, 0]
+    const __m256i w1 = _mm256_set1_epi32((int)(w_b0 | (62 << 8) | (w_b2 << 16)));
+    const __m256i w2 = _mm256_set1_epi32(67 << 8);
+    // Undo the in-lane interleaving of hadd + packus
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    uint32_t x = 0;
+    for (; x + 32 <= width; x += 32) {
+        const __m256i *p = (const __m256i *)(src + (size_t)x * 4);
+        __m256i lo = rgb_to_luma16_avx2(_mm256_loadu_si256(p), _mm256_loadu_si256(p + 1), w1, w2);
+        __m256i hi = rgb_to_luma16_avx2(_mm256_loadu_si256(p + 2), _mm256_loadu_si256(p + 3), w1, w2);
+        __m256i y8 = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(lo, hi), order);
+        _mm256_storeu_si256((__m256i *)(luma + x), y8);
+    }
+    if (bgra)
+        fa_bgra_to_luma_scalar(src + (size_t)x * 4, luma + x, width - x);
+    else
+        fa_rgba_to_luma_scalar(src + (size_t)x * 4, luma + x, width - x);
+}
+
+FA_TARGET("sse2")
+static void bgra_to_luma_sse2(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    rgb_to_luma_sse2<16, 0>(src, luma, width);
+}
+
+FA_TARGET("sse2")
+static void rgba_to_luma_sse2(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    rgb_to_luma_sse2<0, 16>(src, luma, width);
+}
+
+FA_TARGET("avx2")
+static void bgra_to_luma_avx2(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    rgb_to_luma_avx2(src, luma, width, 25, 66, true);
+}
+
+FA_TARGET("avx2")
+static void rgba_to_luma_avx2(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    rgb_to_luma_avx2(src, luma, width, 66, 25, false);
+}
+
+// Packed 4:2:2 -> Y: keep the low (YUY2) or high (UYVY) byte of every
+// 16-bit pair and narrow with packus
+template <bool HighByte>
+FA_TARGET("sse2")
+static void packed422_to_luma_sse2(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    const __m128i mask = _mm_set1_epi16(0xFF);
+    uint32_t x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m128i v0 = _mm_loadu_si128((const __m128i *)(src + (size_t)x * 2));
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(src + (size_t)x * 2 + 16));
+        if (HighByte) {
+            v0 = _mm_srli_epi16(v0, 8);
+            v1 = _mm_srli_epi16(v1, 8);
+        } else {
+            v0 = _mm_and_si128(v0, mask);
+            v1 = _mm_and_si128(v1, mask);
+        }
+        _mm_storeu_si128((__m128i *)(luma + x), _mm_packus_epi16(v0, v1));
+    }
+    if (HighByte)
+        fa_uyvy_to_luma_scalar(src + (size_t)x * 2, luma + x, width - x);
+    else
+        fa_yuy2_to_luma_scalar(src + (size_t)x * 2, luma + x, width - x);
+}
+
+template <bool HighByte>
+FA_TARGET("avx2")
+static void packed422_to_luma_avx2(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    const __m256i mask = _mm256_set1_epi16(0xFF);
+    uint32_t x = 0;
+    for (; x + 32 <= width; x += 32) {
+        __m256i v0 = _mm256_loadu_si256((const __m256i *)(src + (size_t)x * 2));
+        __m256i v1 = _mm256_loadu_si256((const __m256i *)(src + (size_t)x * 2 + 32));
+        if (HighByte) {
+            v0 = _mm256_srli_epi16(v0, 8);
+            v1 = _mm256_srli_epi16(v1, 8);
+        } else {
+            v0 = _mm256_and_si256(v0, mask);
+            v1 = _mm256_and_si256(v1, mask);
+        }
+        // packus works per 128-bit lane; restore linear order of the quadwords
+        __m256i y8 = _mm256_permute4x64_epi64(_mm256_packus_epi16(v0, v1), 0xD8);
+        _mm256_storeu_si256((__m256i *)(luma + x), y8);
+    }
+    if (HighByte)
+        fa_uyvy_to_luma_scalar(src + (size_t)x * 2, luma + x, width - x);
+    else
+        fa_yuy2_to_luma_scalar(src + (size_t)x * 2, luma + x, width - x);
+}
+
+FA_TARGET("sse2")
+static void yuy2_to_luma_sse2(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    packed422_to_luma_sse2<false>(src, luma, width);
+}
+
+FA_TARGET("sse2")
+static void uyvy_to_luma_sse2(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    packed422_to_luma_sse2<true>(src, luma, width);
+}
+
+FA_TARGET("avx2")
+static void yuy2_to_luma_avx2(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    packed422_to_luma_avx2<false>(src, luma, width);
+}
+
+FA_TARGET("avx2")
+static void uyvy_to_luma_avx2(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    packed422_to_luma_avx2<true>(src, luma, width);
+}
+
+struct fa_cpu_features {
+    bool sse2;
+    bool avx2;
+    bool avx512bw;
+};
+
+static void cpuid_count(uint32_t leaf, uint32_t sub, uint32_t regs[4]) {
+#ifdef _MSC_VER
+    int r[4];
+    __cpuidex(r, (int)leaf, (int)sub);
+    for (int i = 0; i < 4; ++i) regs[i] = (uint32_t)r[i];
+#else
+    __cpuid_count(leaf, sub, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static uint64_t read_xcr0(void) {
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    uint32_t lo, hi;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((uint64_t)hi << 32) | lo;
+#endif
+}
+
+static struct fa_cpu_features detect_cpu(void) {
+    struct fa_cpu_features f = {false, false, false};
+    uint32_t r[4];
+    cpuid_count(0, 0, r);
+    uint32_t max_leaf = r[0];
+    if (max_leaf < 1) return f;
+
+    cpuid_count(1, 0, r);
+    f.sse2 = (r[3] >> 26) & 1;
+    bool osxsave = (r[2] >> 27) & 1;
+    bool avx = (r[2] >> 28) & 1;
+    if (!osxsave || !avx || max_leaf < 7) return f;
+
+    // The OS must save YMM (and for AVX-512 also opmask/ZMM) state
+    uint64_t xcr0 = read_xcr0();
+    bool ymm_ok = (xcr0 & 0x6) == 0x6;
+    bool zmm_ok = (xcr0 & 0xE6) == 0xE6;
+
+    cpuid_count(7, 0, r);
+    f.avx2 = ymm_ok && ((r[1] >> 5) & 1);
+    f.avx512bw = zmm_ok && ((r[1] >> 16) & 1) && ((r[1] >> 30) & 1);
+    return f;
+}
+
+#endif // FA_ARCH_X86
+
+// --- ARM ---
+
+#ifdef FA_ARCH_NEON
+
+static size_t count_diff_bytes_neon(const uint8_t *a, const uint8_t *b, size_t size) {
+    size_t same = 0;
+    size_t i = 0;
+    while (size - i >= 16) {
+        size_t blocks = (size - i) / 16;
+        if (blocks > 255) blocks = 255;
+        uint8x16_t acc = vdupq_n_u8(0);
+        for (size_t n = 0; n < blocks; ++n, i += 16) {
+            acc = vsubq_u8(acc, vceqq_u8(vld1q_u8(a + i), vld1q_u8(b + i)));
+        }
+        uint64x2_t sums = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(acc)));
+        same += (size_t)(vgetq_lane_u64(sums, 0) + vgetq_lane_u64(sums, 1));
+    }
+    return (i - same) + fa_count_diff_bytes_scalar(a + i, b + i, size - i);
+}
+
+static size_t count_diff_copy_neon(const uint8_t *src, const uint8_t *ref, uint8_t *dst, size_t size) {
+    size_t same = 0;
+    size_t i = 0;
+    while (size - i >= 16) {
+        size_t blocks = (size - i) / 16;
+        if (blocks > 255) blocks = 255;
+        uint8x16_t acc = vdupq_n_u8(0);
+        for (size_t n = 0; n < blocks; ++n, i += 16) {
+            uint8x16_t vs = vld1q_u8(src + i);
+            vst1q_u8(dst + i, vs);
+            acc = vsubq_u8(acc, vceqq_u8(vs, vld1q_u8(ref + i)));
+        }
+        uint64x2_t sums = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(acc)));
+        same += (size_t)(vgetq_lane_u64(sums, 0) + vgetq_lane_u64(sums, 1));
+    }
+    return (i - same) + fa_count_diff_copy_scalar(src + i, ref + i, dst + i, size - i);
+}
+
+// vld4/vld2 deinterleave the channels; 129 fits an unsigned 8-bit multiplier
+// and the widening multiply-accumulate stays below 65536
+static inline uint8x8_t rgb_to_luma8_neon(uint8x8_t r, uint8x8_t g, uint8x8_t b) {
+    uint16x8_t acc = vmull_u8(r, vdup_n_u8(66));
+    acc = vmlal_u8(acc, g, vdup_n_u8(129));
+    acc = vmlal_u8(acc, b, vdup_n_u8(25));
+    acc = vaddq_u16(acc, vdupq_n_u16(128));
+    return vadd_u8(vshrn_n_u16(acc, 8), vdup_n_u8(16));
+}
+
+static void bgra_to_luma_neon(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    uint32_t x = 0;
+    for (; x + 16 <= width; x += 16) {
+        uint8x16x4_t px = vld4q_u8(src + (size_t)x * 4);
+        uint8x8_t lo = rgb_to_luma8_neon(vget_low_u8(px.val[2]), vget_low_u8(px.val[1]), vget_low_u8(px.val[0]));
+        uint8x8_t hi = rgb_to_luma8_neon(vget_high_u8(px.val[2]), vget_high_u8(px.val[1]), vget_high_u8(px.val[0]));
+        vst1q_u8(luma + x, vcombine_u8(lo, hi));
+    }
+    fa_bgra_to_luma_scalar(src + (size_t)x * 4, luma + x, width - x);
+}
+
+static void rgba_to_luma_neon(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    uint32_t x = 0;
+    for (; x + 16 <= width; x += 16) {
+        uint8x16x4_t px = vld4q_u8(src + (size_t)x * 4);
+        uint8x8_t lo = rgb_to_luma8_neon(vget_low_u8(px.val[0]), vget_low_u8(px.val[1]), vget_low_u8(px.val[2]));
+        uint8x8_t hi = rgb_to_luma8_neon(vget_high_u8(px.val[0]), vget_high_u8(px.val[1]), vget_high_u8(px.val[2]));
+        vst1q_u8(luma + x, vcombine_u8(lo, hi));
+    }
+    fa_rgba_to_luma_scalar(src + (size_t)x * 4, luma + x, width - x);
+}
+
+static void yuy2_to_luma_neon(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    uint32_t x = 0;
+    for (; x + 16 <= width; x += 16) {
+        vst1q_u8(luma + x, vld2q_u8(src + (size_t)x * 2).val[0]);
+    }
+    fa_yuy2_to_luma_scalar(src + (size_t)x * 2, luma + x, width - x);
+}
+
+static void uyvy_to_luma_neon(const uint8_t *src, uint8_t *luma, uint32_t width) {
+    uint32_t x = 0;
+    for (; x + 16 <= width; x += 16) {
+        vst1q_u8(luma + x, vld2q_u8(src + (size_t)x * 2).val[1]);
+    }
+    fa_uyvy_to_luma_scalar(src + (size_t)x * 2, luma + x, width - x);
+}
+
+#endif // FA_ARCH_NEON
+
+// --- Dispatch ---
+
+struct fa_kernel_table fa_kernels = {
+    fa_count_diff_bytes_scalar,
+    fa_count_diff_copy_scalar,
+    fa_bgra_to_luma_scalar,
+    fa_rgba_to_luma_scalar,
+    fa_yuy2_to_luma_scalar,
+    fa_uyvy_to_luma_scalar,
+};
+
+static fa_simd_level_t g_level = FA_SIMD_SCALAR;
+
+bool fa_kernels_supported(fa_simd_level_t level) {
+    switch (level) {
+    case FA_SIMD_SCALAR:
+        return true;
+#ifdef FA_ARCH_X86
+    case FA_SIMD_SSE2:
+        return detect_cpu().sse2;
+    case FA_SIMD_AVX2:
+        return detect_cpu().avx2;
+    case FA_SIMD_AVX512:
+        return detect_cpu().avx512bw;
+#endif
+#ifdef FA_ARCH_NEON
+    case FA_SIMD_NEON:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+bool fa_kernels_select(fa_simd_level_t level) {
+    if (!fa_kernels_supported(level))
+        return false;
+
+    struct fa_kernel_table t = {
+        fa_count_diff_bytes_scalar,
+        fa_count_diff_copy_scalar,
+        fa_bgra_to_luma_scalar,
+        fa_rgba_to_luma_scalar,
+        fa_yuy2_to_luma_scalar,
+        fa_uyvy_to_luma_scalar,
+    };
+    switch (level) {
+#ifdef FA_ARCH_X86
+    case FA_SIMD_SSE2:
+        t.count_diff_bytes = count_diff_bytes_sse2;
+        t.count_diff_copy = count_diff_copy_sse2;
+        t.bgra_to_luma = bgra_to_luma_sse2;
+        t.rgba_to_luma = rgba_to_luma_sse2;
+        t.yuy2_to_luma = yuy2_to_luma_sse2;
+        t.uyvy_to_luma = uyvy_to_luma_sse2;
+        break;
+    case FA_SIMD_AVX2:
+        t.count_diff_bytes = count_diff_bytes_avx2;
+        t.count_diff_copy = count_diff_copy_avx2;
+        t.bgra_to_luma = bgra_to_luma_avx2;
+        t.rgba_to_luma = rgba_to_luma_avx2;
+        t.yuy2_to_luma = yuy2_to_luma_avx2;
+        t.uyvy_to_luma = uyvy_to_luma_avx2;
+        break;
+    case FA_SIMD_AVX512:
+        t.count_diff_bytes = count_diff_bytes_avx512;
+        t.count_diff_copy = count_diff_copy_avx512;
+        // No 512-bit conversions; the AVX2 ones are already memory bound
+        t.bgra_to_luma = bgra_to_luma_avx2;
+        t.rgba_to_luma = rgba_to_luma_avx2;
+        t.yuy2_to_luma = yuy2_to_luma_avx2;
+        t.uyvy_to_luma = uyvy_to_luma_avx2;
+        break;
+#endif
+#ifdef FA_ARCH_NEON
+    case FA_SIMD_NEON:
+        t.count_diff_bytes = count_diff_bytes_neon;
+        t.count_diff_copy = count_diff_copy_neon;
+        t.bgra_to_luma = bgra_to_luma_neon;
+        t.rgba_to_luma = rgba_to_luma_neon;
+        t.yuy2_to_luma = yuy2_to_luma_neon;
+        t.uyvy_to_luma = uyvy_to_luma_neon;
+        break;
+#endif
+    default:
+        break;
+    }
+    fa_kernels = t;
+    g_level = level;
+    return true;
+}
+
+void fa_kernels_init(void) {
+    static const fa_simd_level_t preferred[] = {
+        FA_SIMD_AVX512, FA_SIMD_AVX2, FA_SIMD_SSE2, FA_SIMD_NEON, FA_SIMD_SCALAR
+    };
+    for (fa_simd_level_t level : preferred) {
+        if (fa_kernels_select(level))
+            return;
+    }
+}
+
+fa_simd_level_t fa_kernels_level(void) {
+    return g_level;
+}
+
+const char *fa_simd_level_name(fa_simd_level_t level) {
+    switch (level) {
+    case FA_SIMD_SSE2: return "SSE2";
+    case FA_SIMD_AVX2: return "AVX2";
+    case FA_SIMD_AVX512: return "AVX-512";
+    case FA_SIMD_NEON: return "NEON";
+    default: return "scalar";
+    }
+}
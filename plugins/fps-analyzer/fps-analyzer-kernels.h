@@ -0,0 +1,51 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Hot per-pixel kernels used by the frame analysis.
+// Every kernel has a scalar reference implementation; SIMD variants are
+// picked once at module load by fa_kernels_init() and must return exactly
+// the same results as the scalar code.
+
+typedef enum {
+    FA_SIMD_SCALAR = 0,
+    FA_SIMD_SSE2 = 1,
+    FA_SIMD_AVX2 = 2,
+    FA_SIMD_AVX512 = 3,
+    FA_SIMD_NEON = 4
+} fa_simd_level_t;
+
+struct fa_kernel_table {
+    // Number of positions where a[i] != b[i]
+    size_t (*count_diff_bytes)(const uint8_t *a, const uint8_t *b, size_t size);
+    // Same count for src vs ref, while also copying src into dst
+    size_t (*count_diff_copy)(const uint8_t *src, const uint8_t *ref, uint8_t *dst, size_t size);
+    // One row of packed pixels to 8-bit luma (ITU-R BT.601, studio range):
+    // Y = ((66 R + 129 G + 25 B + 128) >> 8) + 16
+    void (*bgra_to_luma)(const uint8_t *src, uint8_t *luma, uint32_t width);
+    void (*rgba_to_luma)(const uint8_t *src, uint8_t *luma, uint32_t width);
+    // Y plane of packed 4:2:2 rows (YUY2: Y at even bytes, UYVY: at odd bytes)
+    void (*yuy2_to_luma)(const uint8_t *src, uint8_t *luma, uint32_t width);
+    void (*uyvy_to_luma)(const uint8_t *src, uint8_t *luma, uint32_t width);
+};
+
+// Active kernels. Scalar until fa_kernels_init() runs.
+extern struct fa_kernel_table fa_kernels;
+
+// Select the fastest variant supported by this CPU
+void fa_kernels_init(void);
+// Force a specific variant (benchmarks, testing). Returns false and keeps
+// the current table if the CPU or the build does not support it.
+bool fa_kernels_select(fa_simd_level_t level);
+bool fa_kernels_supported(fa_simd_level_t level);
+fa_simd_level_t fa_kernels_level(void);
+const char *fa_simd_level_name(fa_simd_level_t level);
+
+// Scalar reference implementations
+size_t fa_count_diff_bytes_scalar(const uint8_t *a, const uint8_t *b, size_t size);
+size_t fa_count_diff_copy_scalar(const uint8_t *src, const uint8_t *ref, uint8_t *dst, size_t size);
+void fa_bgra_to_luma_scalar(const uint8_t *src, uint8_t *luma, uint32_t width);
+void fa_rgba_to_luma_scalar(const uint8_t *src, uint8_t *luma, uint32_t width);
+void fa_yuy2_to_luma_scalar(const uint8_t *src, uint8_t *luma, uint32_t width);
+void fa_uyvy_to_luma_scalar(const uint8_t *src, uint8_t *luma, uint32_t width);
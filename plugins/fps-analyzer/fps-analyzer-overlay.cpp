@@ -7,6 +7,8 @@
 #include <math.h>
 
 #include "fps-shared-data.h"
+#include "fps-analyzer-kernels.h"
+#include "fps-analyzer-text.h"
 
 // Declare filter info for registration
 extern struct obs_source_info fps_analyzer_filter_info;
@@ -14,12 +16,17 @@ extern struct obs_source_info fps_analyzer_filter_info;
 #define GRAPH_MARGIN 20
 #define GRAPH_LEGEND_WIDTH 80
 #define MAX_GRID_LABELS 16
+#define GRID_LABEL_LEN 16
 #define LINE_THICKNESS 2
 
 // Graph styles
 #define GRAPH_STYLE_BIG 0
 #define GRAPH_STYLE_COMPACT 1
 
+// Frames the lows / percentiles text covers
+#define LOWS_SESSION 0
+#define LOWS_RECENT 1
+
 // Big: 1920x360
 #define BIG_PLOT_W 1920
 #define BIG_PLOT_H 360
@@ -27,30 +34,72 @@ extern struct obs_source_info fps_analyzer_filter_info;
 #define COMPACT_PLOT_W 300
 #define COMPACT_PLOT_H 80
 
+// All solid geometry of one graph (panel, grid lines, pacing and tearing
+// bands, data line) is collected as GS_TRIS quads with per-vertex colors in
+// a dynamic vertex buffer and drawn with a single gs_draw(). Sized by the
+// plot width, whatever the history length: with more points than columns
+// the bands and the line get one quad per column at most, otherwise one
+// per point.
+#define GRAPH_GRID_LINES_MAX 64
+#define GRAPH_BATCH_QUADS(plot_w) (1 + GRAPH_GRID_LINES_MAX + 3 * ((plot_w) + 1))
+
+// Text fonts: the main text at the configured size, graph titles and grid
+// labels at a fixed size. Glyph capacity of the text batches: the whole
+// overlay text, and both titles plus every grid label of both graphs.
+#define LABEL_FONT_SIZE 18
+#define TEXT_BATCH_GLYPHS 512
+#define GRAPH_TITLE_LEN 48
+#define LABEL_BATCH_GLYPHS (2 * (GRAPH_TITLE_LEN + MAX_GRID_LABELS * GRID_LABEL_LEN))
+
+struct graph_batch
+{
+    gs_vertbuffer_t *vb; // created on the first render, graphics thread
+    uint32_t capacity;   // vertices of vb, follows the graph style
+    uint32_t used;       // vertices written this frame
+};
+
 struct fps_overlay_source
 {
-    obs_source_t *text_source;
-    obs_source_t *label_frametime;
-    obs_source_t *label_fps;
+    // Analyzer to display: channel name, empty = the oldest filter.
+    // Resolved on every tick.
+    char analyzer[FPS_SHARED_NAME_MAX];
+    struct fps_shared_channel *channel;
     int font_size;
     bool show_text_background;
     bool show_fps_text;
     bool show_frametime_text;
     bool show_tearing_text;
+    bool show_lows_text;
+    int lows_scope; // LOWS_SESSION or LOWS_RECENT
+    bool show_pacing_text;
+    bool pacing_tint; // frametime graph background by pacing class
     bool show_frametime_graph;
     bool show_fps_graph;
     int frametime_style; // GRAPH_STYLE_BIG or GRAPH_STYLE_COMPACT
     int fps_style;
     double frametime_scale; // 0 = auto, otherwise fixed max (e.g. 16.67, 33.33)
     double fps_scale;       // 0 = auto, otherwise fixed max (e.g. 60, 120)
-    // Grid label pools
-    obs_source_t *ft_grid_labels[MAX_GRID_LABELS];
+    // Grid labels
+    char ft_grid_text[MAX_GRID_LABELS][GRID_LABEL_LEN];
     int ft_grid_count;
     double ft_grid_values[MAX_GRID_LABELS];
-    obs_source_t *fps_grid_labels[MAX_GRID_LABELS];
+    char fps_grid_text[MAX_GRID_LABELS][GRID_LABEL_LEN];
     int fps_grid_count;
     double fps_grid_values[MAX_GRID_LABELS];
     char last_text[512];
+    bool text_dirty;  // last_text changed since text_batch was filled
+    bool fonts_dirty; // font size or background changed, text font to switch
+    // Graphics thread: created on the first render, rebuilt when dirty
+    struct fps_text_font *text_font;
+    struct fps_text_font *label_font;
+    struct fps_text_batch *text_batch;
+    struct fps_text_batch *label_batch;
+    struct graph_batch ft_batch;
+    struct graph_batch fps_batch;
+    // Draw calls issued by render (geometry and text batches)
+    uint64_t renders;
+    uint64_t draw_calls;
+    int max_draw_calls;
 };
 
 static const char *fps_overlay_get_name(void *unused)
@@ -59,76 +108,17 @@ static const char *fps_overlay_get_name(void *unused)
     return "FPS Analyzer 0.4";
 }
 
-static void update_text_source(struct fps_overlay_source *ctx, const char *text)
+static bool overlay_has_text(const struct fps_overlay_source *ctx)
 {
-    if (!ctx->text_source)
-        return;
-
-    obs_data_t *font_obj = obs_data_create();
-    obs_data_set_string(font_obj, "face", "Arial");
-    obs_data_set_int(font_obj, "size", ctx->font_size);
-    obs_data_set_int(font_obj, "flags", 1); // bold
-    obs_data_set_string(font_obj, "style", "Bold");
-
-    obs_data_t *settings = obs_data_create();
-    obs_data_set_string(settings, "text", text);
-    obs_data_set_obj(settings, "font", font_obj);
-    obs_data_set_int(settings, "color1", 0xFFFFFF);
-    obs_data_set_int(settings, "color2", 0xFFFFFF);
-    obs_data_set_int(settings, "opacity", 100);
-    obs_data_set_bool(settings, "outline", true);
-    obs_data_set_int(settings, "outline_size", 2);
-    obs_data_set_int(settings, "outline_color", 0x000000);
-    obs_data_set_int(settings, "outline_opacity", 100);
-
-    // Background
-    obs_data_set_int(settings, "bk_color", 0x000000);
-    obs_data_set_int(settings, "bk_opacity", ctx->show_text_background ? 80 : 0);
-
-    obs_source_update(ctx->text_source, settings);
-
-    obs_data_release(font_obj);
-    obs_data_release(settings);
-}
-
-static obs_source_t *create_label_source(const char *text, const char *name, int size, bool bold)
-{
-    obs_data_t *font_obj = obs_data_create();
-    obs_data_set_string(font_obj, "face", "Arial");
-    obs_data_set_int(font_obj, "size", size);
-    obs_data_set_int(font_obj, "flags", bold ? 1 : 0);
-    obs_data_set_string(font_obj, "style", bold ? "Bold" : "Regular");
-
-    obs_data_t *settings = obs_data_create();
-    obs_data_set_string(settings, "text", text);
-    obs_data_set_obj(settings, "font", font_obj);
-    obs_data_set_int(settings, "color1", 0xFFFFFF);
-    obs_data_set_int(settings, "color2", 0xFFFFFF);
-    obs_data_set_int(settings, "opacity", 80);
-    obs_data_set_bool(settings, "outline", true);
-    obs_data_set_int(settings, "outline_size", 1);
-    obs_data_set_int(settings, "outline_color", 0x000000);
-    obs_data_set_int(settings, "outline_opacity", 100);
-
-    obs_source_t *src = obs_source_create_private("text_gdiplus", name, settings);
-
-    obs_data_release(font_obj);
-    obs_data_release(settings);
-    return src;
+    return ctx->show_fps_text || ctx->show_frametime_text || ctx->show_tearing_text ||
+           ctx->show_lows_text || ctx->show_pacing_text;
 }
 
 // Build grid labels for a given step and max value
 // is_ms: true = format as "Xms", false = format as integer
-static void build_grid_labels(obs_source_t **labels, double *values, int *out_count,
+static void build_grid_labels(char (*labels)[GRID_LABEL_LEN], double *values, int *out_count,
                               double step, double max_val, bool is_ms)
 {
-    // Free old labels
-    for (int i = 0; i < *out_count; i++)
-    {
-        if (labels[i])
-            obs_source_release(labels[i]);
-        labels[i] = NULL;
-    }
     *out_count = 0;
 
     if (step <= 0 || max_val <= 0)
@@ -140,7 +130,7 @@ static void build_grid_labels(obs_source_t **labels, double *values, int *out_co
     {
         double v = n * step;
 
-        char text[32];
+        char *text = labels[*out_count];
         if (is_ms)
         {
             // Display as clean frametime: show what FPS this corresponds to
@@ -156,16 +146,12 @@ static void build_grid_labels(obs_source_t **labels, double *values, int *out_co
                 rounded = 50.00;
             else if (fabs(rounded - 66.67) < 0.02)
                 rounded = 66.67;
-            snprintf(text, sizeof(text), "%.2fms", rounded);
+            snprintf(text, GRID_LABEL_LEN, "%.2fms", rounded);
         }
         else
-            snprintf(text, sizeof(text), "%d", (int)round(v));
-
-        char name[64];
-        snprintf(name, sizeof(name), "grid_%d", *out_count);
+            snprintf(text, GRID_LABEL_LEN, "%d", (int)round(v));
 
         values[*out_count] = v;
-        labels[*out_count] = create_label_source(text, name, 18, true);
         (*out_count)++;
     }
 }
@@ -188,23 +174,227 @@ static void get_graph_dims(int style, int *pw, int *ph, int *total_w, int *total
 
 // --- Graph rendering ---
 
-// ref_label1/ref_label2: text sources for reference line labels
-// max_override: if >0, use as fixed Y-axis max; if 0, auto-scale
+// Vertex color: RGBA bytes in memory, as the SolidColored technique reads them
+static inline uint32_t graph_color(float r, float g, float b, float a)
+{
+    return (uint32_t)(r * 255.0f + 0.5f) | ((uint32_t)(g * 255.0f + 0.5f) << 8) |
+           ((uint32_t)(b * 255.0f + 0.5f) << 16) | ((uint32_t)(a * 255.0f + 0.5f) << 24);
+}
+
+static void graph_batch_free(struct graph_batch *batch);
+
+static bool graph_batch_begin(struct graph_batch *batch, int plot_w)
+{
+    uint32_t verts = GRAPH_BATCH_QUADS(plot_w) * 6;
+    if (batch->vb && batch->capacity != verts)
+        graph_batch_free(batch);
+    if (!batch->vb)
+    {
+        struct gs_vb_data *vbd = gs_vbdata_create();
+        vbd->num = verts;
+        vbd->points = (struct vec3 *)bzalloc(sizeof(struct vec3) * verts);
+        vbd->colors = (uint32_t *)bzalloc(sizeof(uint32_t) * verts);
+        batch->vb = gs_vertexbuffer_create(vbd, GS_DYNAMIC);
+        if (!batch->vb)
+            return false;
+        batch->capacity = verts;
+    }
+    batch->used = 0;
+    return true;
+}
+
+static void graph_batch_quad(struct graph_batch *batch, float x, float y, float w, float h, uint32_t color)
+{
+    if (batch->used + 6 > batch->capacity)
+        return;
+    struct gs_vb_data *vbd = gs_vertexbuffer_get_data(batch->vb);
+    struct vec3 *p = vbd->points + batch->used;
+    uint32_t *c = vbd->colors + batch->used;
+    const float xs[6] = {x, x + w, x, x, x + w, x + w};
+    const float ys[6] = {y, y, y + h, y + h, y, y + h};
+    for (int i = 0; i < 6; i++)
+    {
+        p[i].x = xs[i];
+        p[i].y = ys[i];
+        p[i].z = 0.0f;
+        c[i] = color;
+    }
+    batch->used += 6;
+}
+
+// Returns the number of draw calls issued (0 or 1)
+static int graph_batch_draw(struct graph_batch *batch)
+{
+    if (batch->used == 0)
+        return 0;
+    gs_effect_t *solid = obs_get_base_effect(OBS_EFFECT_SOLID);
+    if (!solid)
+        return 0;
+    gs_eparam_t *color_param = gs_effect_get_param_by_name(solid, "color");
+    gs_technique_t *tech = gs_effect_get_technique(solid, "SolidColored");
+    if (!color_param || !tech)
+        return 0;
+
+    struct vec4 white;
+    vec4_set(&white, 1.0f, 1.0f, 1.0f, 1.0f);
+    gs_effect_set_vec4(color_param, &white);
+
+    // Upload only the vertices written this frame: flushing copies vbd->num
+    // of them, the whole capacity otherwise
+    struct gs_vb_data *vbd = gs_vertexbuffer_get_data(batch->vb);
+    vbd->num = batch->used;
+    gs_vertexbuffer_flush(batch->vb);
+    vbd->num = batch->capacity;
+    gs_load_vertexbuffer(batch->vb);
+    gs_load_indexbuffer(NULL);
+    gs_technique_begin(tech);
+    gs_technique_begin_pass(tech, 0);
+    gs_draw(GS_TRIS, 0, batch->used);
+    gs_technique_end_pass(tech);
+    gs_technique_end(tech);
+    gs_load_vertexbuffer(NULL);
+    return 1;
+}
+
+static void graph_batch_free(struct graph_batch *batch)
+{
+    if (batch->vb)
+        gs_vertexbuffer_destroy(batch->vb);
+    batch->vb = NULL;
+    batch->capacity = 0;
+}
+
+// Band class of point i, 0 = no band; higher classes win a shared column
+typedef int (*graph_class_fn)(const uint8_t *data, int i);
+
+static int graph_pacing_class(const uint8_t *pacing, int i)
+{
+    return pacing[i]; // fa_pace_t: stutter over uneven over ok
+}
+
+static int graph_tearing_class(const uint8_t *tearing, int i)
+{
+    return (tearing[i >> 3] >> (i & 7)) & 1;
+}
+
+// Full-height bands behind the points of class > 0, colors[class]. Runs of
+// equal points become one band; with more points than plot columns
+// (per_column) a column takes the highest class of its points and runs of
+// equal columns become one band, so the quads follow the graph width.
+static void graph_batch_bands(struct graph_batch *batch, const uint8_t *data, graph_class_fn class_at,
+                              const uint32_t *colors, int count, int data_offset, float step, int gh,
+                              bool per_column)
+{
+    const float ox = (float)GRAPH_MARGIN;
+    const float oy = (float)GRAPH_MARGIN;
+    if (!per_column)
+    {
+        for (int i = 0; i < count;)
+        {
+            int cls = class_at(data, i);
+            int end = i + 1;
+            while (end < count && class_at(data, end) == cls)
+                end++;
+            if (cls != 0)
+            {
+                float w = (float)(end - i) * step + 1.0f;
+                if (w < 2.0f)
+                    w = 2.0f;
+                graph_batch_quad(batch, ox + (float)(data_offset + i) * step, oy, w, (float)gh, colors[cls]);
+            }
+            i = end;
+        }
+        return;
+    }
+
+    int col = -1, cls = 0;
+    int run_first = 0, run_end = 0, run_cls = 0;
+    for (int i = 0; i <= count; i++)
+    {
+        int c = i < count ? (int)((float)(data_offset + i) * step) : -2;
+        if (c != col)
+        {
+            if (col >= 0)
+            {
+                if (cls != run_cls)
+                {
+                    if (run_cls != 0)
+                        graph_batch_quad(batch, ox + (float)run_first, oy, (float)(run_end - run_first),
+                                         (float)gh, colors[run_cls]);
+                    run_first = col;
+                    run_cls = cls;
+                }
+                run_end = col + 1;
+            }
+            if (i == count)
+                break;
+            col = c;
+            cls = 0;
+        }
+        int k = class_at(data, i);
+        if (k > cls)
+            cls = k;
+    }
+    if (run_cls != 0)
+        graph_batch_quad(batch, ox + (float)run_first, oy, (float)(run_end - run_first), (float)gh,
+                         colors[run_cls]);
+}
+
+// Plot y of a value, clamped to the plot area
+static inline float graph_value_y(double v, double max_val, int gh)
+{
+    float fy = (float)(gh - (v / max_val) * gh);
+    if (fy < 0.0f)
+        return 0.0f;
+    return fy > (float)gh ? (float)gh : fy;
+}
+
+// Green / yellow / red by the thresholds, for the worst value of a segment
+static uint32_t graph_line_color(double v_worst, bool higher_is_better, double green_thresh,
+                                 double yellow_thresh)
+{
+    const uint32_t green = graph_color(0.0f, 1.0f, 0.0f, 1.0f);
+    const uint32_t yellow = graph_color(1.0f, 1.0f, 0.0f, 1.0f);
+    const uint32_t red = graph_color(1.0f, 0.0f, 0.0f, 1.0f);
+    if (higher_is_better)
+        return v_worst >= green_thresh ? green : (v_worst >= yellow_thresh ? yellow : red);
+    return v_worst <= green_thresh ? green : (v_worst <= yellow_thresh ? yellow : red);
+}
+
+// grid_labels/grid_values: reference line labels, added to the labels batch
+// (drawn by the caller) at y_offset, the graph's position in the overlay
+// max_override: if >0, use as fixed Y-axis max; if 0, auto-scale to data_max,
+// the largest value (kept by the filter, so nothing is scanned here)
 // ref_step: distance between reference lines (e.g. 10 for every 10 units). 0 = no grid.
-static void render_line_graph(const double *values, int count,
-                              double ref_step,
-                              bool show_tearing, bool higher_is_better,
-                              double green_thresh, double yellow_thresh,
-                              double max_override,
-                              obs_source_t **grid_labels, double *grid_values, int grid_count,
-                              int style)
+// values: fixed point, units per graphed unit (e.g. FA_SMOOTHED_UNITS_PER_MS)
+// tearing: bitset, entry i is bit i & 7 of byte i / 8
+// pacing: fa_pace_t per point, tints the background of uneven and stutter frames. NULL = no tint.
+// length: points of a full history, spread over the plot width; the
+// count newest points are right-aligned
+// Returns the number of draw calls issued.
+static int render_line_graph(struct graph_batch *batch,
+                             const uint16_t *values, double units, const uint8_t *tearing,
+                             const uint8_t *pacing, int count, int length,
+                             double ref_step,
+                             bool show_tearing, bool higher_is_better,
+                             double green_thresh, double yellow_thresh,
+                             double max_override, double data_max,
+                             const char (*grid_labels)[GRID_LABEL_LEN], const double *grid_values,
+                             int grid_count, struct fps_text_batch *labels,
+                             const struct fps_text_font *label_font, float y_offset,
+                             int style)
 {
     if (count < 2)
-        return;
+        return 0;
+    if (length < count)
+        length = count;
 
     int gw, gh, total_w, total_h;
     get_graph_dims(style, &gw, &gh, &total_w, &total_h);
-    float step = (float)gw / (float)(FPS_GRAPH_HISTORY - 1);
+    if (!graph_batch_begin(batch, gw))
+        return 0;
+    float step = (float)gw / (float)(length - 1);
+    bool per_column = count - 1 > gw;
 
     // Y-axis scaling
     double max_val;
@@ -214,156 +404,131 @@ static void render_line_graph(const double *values, int count,
     }
     else
     {
-        max_val = 1.0;
-        for (int i = 0; i < count; i++)
-        {
-            if (values[i] > max_val)
-                max_val = values[i];
-        }
+        max_val = data_max > 1.0 ? data_max : 1.0;
         max_val *= 1.1; // 10% headroom
     }
 
-    gs_effect_t *solid = obs_get_base_effect(OBS_EFFECT_SOLID);
-    if (!solid)
-        return;
-    gs_eparam_t *color_param = gs_effect_get_param_by_name(solid, "color");
-    gs_technique_t *tech = gs_effect_get_technique(solid, "Solid");
-    if (!color_param || !tech)
-        return;
-
-    struct vec4 col;
-
-    // === PASS 1: All solid geometry ===
-    gs_technique_begin(tech);
-    gs_technique_begin_pass(tech, 0);
-
     // Panel background
-    vec4_set(&col, 0.0f, 0.0f, 0.0f, 0.8f);
-    gs_effect_set_vec4(color_param, &col);
-    gs_draw_sprite(0, 0, (uint32_t)total_w, (uint32_t)total_h);
+    graph_batch_quad(batch, 0.0f, 0.0f, (float)total_w, (float)total_h, graph_color(0.0f, 0.0f, 0.0f, 0.8f));
 
-    // Enter plot area
-    gs_matrix_push();
-    gs_matrix_translate3f((float)GRAPH_MARGIN, (float)GRAPH_MARGIN, 0.0f);
+    // Everything else in plot area coordinates
+    const float ox = (float)GRAPH_MARGIN;
+    const float oy = (float)GRAPH_MARGIN;
 
     // Reference grid lines (including 0 at bottom)
     if (ref_step > 0)
     {
-        vec4_set(&col, 1.0f, 1.0f, 1.0f, 0.15f);
-        gs_effect_set_vec4(color_param, &col);
-        for (int n = 0; n * ref_step <= max_val + 0.01; n++)
+        uint32_t grid_col = graph_color(1.0f, 1.0f, 1.0f, 0.15f);
+        for (int n = 0; n * ref_step <= max_val + 0.01 && n < GRAPH_GRID_LINES_MAX; n++)
         {
             double v = n * ref_step;
             int y_ref = gh - (int)((v / max_val) * gh);
             if (y_ref >= 0 && y_ref < gh)
-            {
-                gs_matrix_push();
-                gs_matrix_translate3f(0.0f, (float)y_ref, 0.0f);
-                gs_draw_sprite(0, 0, (uint32_t)gw, 1);
-                gs_matrix_pop();
-            }
+                graph_batch_quad(batch, ox, oy + (float)y_ref, (float)gw, 1.0f, grid_col);
         }
     }
 
+    int data_offset = length - count;
+
+    // Pacing tint: amber for frames off the cadence, magenta for stutters
+    if (pacing)
+    {
+        const uint32_t pace_cols[3] = {0, graph_color(1.0f, 0.6f, 0.0f, 0.25f),
+                                       graph_color(1.0f, 0.0f, 1.0f, 0.35f)};
+        graph_batch_bands(batch, pacing, graph_pacing_class, pace_cols, count, data_offset, step, gh,
+                          per_column);
+    }
+
     // Tearing indicators
-    int data_offset = FPS_GRAPH_HISTORY - count;
     if (show_tearing)
     {
-        vec4_set(&col, 1.0f, 0.0f, 0.0f, 0.4f);
-        gs_effect_set_vec4(color_param, &col);
-        for (int i = 0; i < count; i++)
-        {
-            if (g_fps_shared.graph_tearing[i])
-            {
-                float x = (float)(data_offset + i) * step;
-                int seg_w = (int)(step + 1.0f);
-                if (seg_w < 2)
-                    seg_w = 2;
-                gs_matrix_push();
-                gs_matrix_translate3f(x, 0.0f, 0.0f);
-                gs_draw_sprite(0, 0, (uint32_t)seg_w, (uint32_t)gh);
-                gs_matrix_pop();
-            }
-        }
+        const uint32_t tearing_cols[2] = {0, graph_color(1.0f, 0.0f, 0.0f, 0.4f)};
+        graph_batch_bands(batch, tearing, graph_tearing_class, tearing_cols, count, data_offset, step, gh,
+                          per_column);
     }
 
     // Data line
-    for (int i = 0; i < count - 1; i++)
-    {
-        double v0 = values[i];
-        double v1 = values[i + 1];
-        float x0 = (float)(data_offset + i) * step;
-        float x1 = (float)(data_offset + i + 1) * step;
-        float fy0 = (float)(gh - (v0 / max_val) * gh);
-        float fy1 = (float)(gh - (v1 / max_val) * gh);
-        if (fy0 < 0)
-            fy0 = 0;
-        if (fy0 > gh)
-            fy0 = (float)gh;
-        if (fy1 < 0)
-            fy1 = 0;
-        if (fy1 > gh)
-            fy1 = (float)gh;
-
-        double v_worst = higher_is_better ? (v0 < v1 ? v0 : v1) : (v0 > v1 ? v0 : v1);
-        if (higher_is_better)
+    if (per_column)
+    {
+        // More points than plot columns (Compact): one vertical span per
+        // column from its lowest to its highest point, joined to the last
+        // point of the column before, so the geometry follows the graph
+        // width and a single-frame spike always covers its column. Colored
+        // by the column's worst point.
+        int col = -1;
+        uint16_t lo = 0, hi = 0, last = values[0];
+        for (int i = 0; i <= count; i++)
         {
-            if (v_worst >= green_thresh)
-                vec4_set(&col, 0.0f, 1.0f, 0.0f, 1.0f);
-            else if (v_worst >= yellow_thresh)
-                vec4_set(&col, 1.0f, 1.0f, 0.0f, 1.0f);
-            else
-                vec4_set(&col, 1.0f, 0.0f, 0.0f, 1.0f);
+            int c = i < count ? (int)((float)(data_offset + i) * step) : -2;
+            if (c != col)
+            {
+                if (col >= 0)
+                {
+                    float top = graph_value_y(hi / units, max_val, gh);
+                    float seg_h = graph_value_y(lo / units, max_val, gh) - top;
+                    if (seg_h < LINE_THICKNESS)
+                        seg_h = (float)LINE_THICKNESS;
+                    uint32_t color = graph_line_color((higher_is_better ? lo : hi) / units, higher_is_better,
+                                                      green_thresh, yellow_thresh);
+                    graph_batch_quad(batch, ox + (float)col, oy + top, (float)LINE_THICKNESS,
+                                     (float)(uint32_t)seg_h, color);
+                }
+                if (i == count)
+                    break;
+                col = c;
+                lo = hi = last;
+            }
+            uint16_t v = values[i];
+            if (v < lo)
+                lo = v;
+            if (v > hi)
+                hi = v;
+            last = v;
         }
-        else
+    }
+    else
+    {
+        for (int i = 0; i < count - 1; i++)
         {
-            if (v_worst <= green_thresh)
-                vec4_set(&col, 0.0f, 1.0f, 0.0f, 1.0f);
-            else if (v_worst <= yellow_thresh)
-                vec4_set(&col, 1.0f, 1.0f, 0.0f, 1.0f);
-            else
-                vec4_set(&col, 1.0f, 0.0f, 0.0f, 1.0f);
+            double v0 = values[i] / units;
+            double v1 = values[i + 1] / units;
+            float x0 = (float)(data_offset + i) * step;
+            float x1 = (float)(data_offset + i + 1) * step;
+            float fy0 = graph_value_y(v0, max_val, gh);
+            float fy1 = graph_value_y(v1, max_val, gh);
+
+            double v_worst = higher_is_better ? (v0 < v1 ? v0 : v1) : (v0 > v1 ? v0 : v1);
+            float top = fy0 < fy1 ? fy0 : fy1;
+            float bot = fy0 > fy1 ? fy0 : fy1;
+            float seg_h = bot - top;
+            if (seg_h < LINE_THICKNESS)
+                seg_h = (float)LINE_THICKNESS;
+            float seg_w = x1 - x0;
+            if (seg_w < 1.0f)
+                seg_w = 1.0f;
+
+            // Same pixel size as the former per-segment sprites (width truncated + 1)
+            graph_batch_quad(batch, ox + x0, oy + top, (float)(uint32_t)(seg_w + 1.0f), (float)(uint32_t)seg_h,
+                             graph_line_color(v_worst, higher_is_better, green_thresh, yellow_thresh));
         }
-        gs_effect_set_vec4(color_param, &col);
-
-        float top = fy0 < fy1 ? fy0 : fy1;
-        float bot = fy0 > fy1 ? fy0 : fy1;
-        float seg_h = bot - top;
-        if (seg_h < LINE_THICKNESS)
-            seg_h = (float)LINE_THICKNESS;
-        float seg_w = x1 - x0;
-        if (seg_w < 1.0f)
-            seg_w = 1.0f;
-
-        gs_matrix_push();
-        gs_matrix_translate3f(x0, top, 0.0f);
-        gs_draw_sprite(0, 0, (uint32_t)(seg_w + 1.0f), (uint32_t)seg_h);
-        gs_matrix_pop();
     }
 
-    // Leave plot area
-    gs_matrix_pop();
-
-    gs_technique_end_pass(tech);
-    gs_technique_end(tech);
+    int draws = graph_batch_draw(batch);
 
     // Grid labels — rendered right of plot area
-    for (int g = 0; g < grid_count; g++)
+    for (int g = 0; g < grid_count && labels && label_font; g++)
     {
-        if (!grid_labels[g])
-            continue;
         double v = grid_values[g];
         int y_ref = gh - (int)((v / max_val) * gh);
         if (y_ref < 0 || y_ref >= gh)
             continue;
 
-        uint32_t lh = obs_source_get_height(grid_labels[g]);
-        gs_matrix_push();
-        gs_matrix_translate3f((float)(GRAPH_MARGIN + gw + 8),
-                              (float)(GRAPH_MARGIN + y_ref - (int)lh / 2), 0.0f);
-        obs_source_video_render(grid_labels[g]);
-        gs_matrix_pop();
+        uint32_t lw, lh;
+        fps_text_measure(LABEL_FONT_SIZE, grid_labels[g], &lw, &lh);
+        fps_text_batch_add(labels, label_font, (float)(GRAPH_MARGIN + gw + 8),
+                           y_offset + (float)(GRAPH_MARGIN + y_ref - (int)lh / 2), grid_labels[g]);
     }
+    return draws;
 }
 
 static void rebuild_grid_labels(struct fps_overlay_source *ctx)
@@ -371,7 +536,7 @@ static void rebuild_grid_labels(struct fps_overlay_source *ctx)
     // Frametime grid — step depends on scale range
     double ft_max = ctx->frametime_scale > 0 ? ctx->frametime_scale : 50.0;
     double ft_step = (ft_max > 33.33) ? (1000.0 / 60.0) : (1000.0 / 120.0);
-    build_grid_labels(ctx->ft_grid_labels, ctx->ft_grid_values, &ctx->ft_grid_count,
+    build_grid_labels(ctx->ft_grid_text, ctx->ft_grid_values, &ctx->ft_grid_count,
                       ft_step, ft_max, true);
 
     // FPS grid
@@ -383,7 +548,7 @@ static void rebuild_grid_labels(struct fps_overlay_source *ctx)
         fps_step = 10.0;
     else
         fps_step = 10.0;
-    build_grid_labels(ctx->fps_grid_labels, ctx->fps_grid_values, &ctx->fps_grid_count,
+    build_grid_labels(ctx->fps_grid_text, ctx->fps_grid_values, &ctx->fps_grid_count,
                       fps_step, fps_max, false);
 }
 
@@ -401,28 +566,21 @@ static void *fps_overlay_create(obs_data_t *settings, obs_source_t *source)
     ctx->show_fps_text = obs_data_get_bool(settings, "show_fps_text");
     ctx->show_frametime_text = obs_data_get_bool(settings, "show_frametime_text");
     ctx->show_tearing_text = obs_data_get_bool(settings, "show_tearing_text");
+    ctx->show_lows_text = obs_data_get_bool(settings, "show_lows_text");
+    ctx->lows_scope = (int)obs_data_get_int(settings, "lows_scope");
+    ctx->show_pacing_text = obs_data_get_bool(settings, "show_pacing_text");
+    ctx->pacing_tint = obs_data_get_bool(settings, "pacing_tint");
     ctx->show_frametime_graph = obs_data_get_bool(settings, "show_frametime_graph");
     ctx->frametime_style = (int)obs_data_get_int(settings, "frametime_style");
     ctx->show_fps_graph = obs_data_get_bool(settings, "show_fps_graph");
     ctx->fps_style = (int)obs_data_get_int(settings, "fps_style");
     ctx->frametime_scale = obs_data_get_double(settings, "frametime_scale");
     ctx->fps_scale = obs_data_get_double(settings, "fps_scale");
+    snprintf(ctx->analyzer, sizeof(ctx->analyzer), "%s", obs_data_get_string(settings, "analyzer"));
 
-    ctx->last_text[0] = '\0';
-
-    // Create private text_gdiplus source (not visible in OBS source list)
-    obs_data_t *text_settings = obs_data_create();
-    obs_data_set_string(text_settings, "text", "Initializing...");
-    ctx->text_source = obs_source_create_private("text_gdiplus", "fps_overlay_text", text_settings);
-    obs_data_release(text_settings);
-
-    if (ctx->text_source)
-    {
-        update_text_source(ctx, "Initializing...");
-    }
-
-    ctx->label_frametime = create_label_source("FRAMETIME", "fps_label_ft", 18, true);
-    ctx->label_fps = create_label_source("FRAMERATE", "fps_label_fps", 18, true);
+    // Fonts and batches are created by the first render (graphics thread)
+    snprintf(ctx->last_text, sizeof(ctx->last_text), "Initializing...");
+    ctx->text_dirty = true;
     rebuild_grid_labels(ctx);
 
     return ctx;
@@ -433,18 +591,19 @@ static void fps_overlay_destroy(void *data)
     struct fps_overlay_source *ctx = (struct fps_overlay_source *)data;
     if (ctx)
     {
-        if (ctx->text_source)
-            obs_source_release(ctx->text_source);
-        if (ctx->label_frametime)
-            obs_source_release(ctx->label_frametime);
-        if (ctx->label_fps)
-            obs_source_release(ctx->label_fps);
-        for (int i = 0; i < ctx->ft_grid_count; i++)
-            if (ctx->ft_grid_labels[i])
-                obs_source_release(ctx->ft_grid_labels[i]);
-        for (int i = 0; i < ctx->fps_grid_count; i++)
-            if (ctx->fps_grid_labels[i])
-                obs_source_release(ctx->fps_grid_labels[i]);
+        obs_enter_graphics();
+        fps_text_font_release(ctx->text_font);
+        fps_text_font_release(ctx->label_font);
+        fps_text_font_cache_free();
+        fps_text_batch_destroy(ctx->text_batch);
+        fps_text_batch_destroy(ctx->label_batch);
+        graph_batch_free(&ctx->ft_batch);
+        graph_batch_free(&ctx->fps_batch);
+        obs_leave_graphics();
+        if (ctx->renders > 0)
+            blog(LOG_DEBUG, "[FPS Analyzer] Overlay: %.1f draw calls per frame on average, %d at most (%llu frames)",
+                 (double)ctx->draw_calls / ctx->renders, ctx->max_draw_calls,
+                 (unsigned long long)ctx->renders);
     }
     bfree(data);
 }
@@ -456,16 +615,37 @@ static bool graph_toggle_modified(obs_properties_t *props, obs_property_t *p, ob
     bool fps_on = obs_data_get_bool(settings, "show_fps_graph");
     obs_property_set_visible(obs_properties_get(props, "frametime_style"), ft_on);
     obs_property_set_visible(obs_properties_get(props, "frametime_scale"), ft_on);
+    obs_property_set_visible(obs_properties_get(props, "pacing_tint"), ft_on);
     obs_property_set_visible(obs_properties_get(props, "fps_style"), fps_on);
     obs_property_set_visible(obs_properties_get(props, "fps_scale"), fps_on);
+    obs_property_set_visible(obs_properties_get(props, "lows_scope"),
+                             obs_data_get_bool(settings, "show_lows_text"));
     return true;
 }
 
 static obs_properties_t *fps_overlay_properties(void *data)
 {
-    UNUSED_PARAMETER(data);
     obs_properties_t *props = obs_properties_create();
 
+    // Analyzer to display, listed as "<source> / <filter>"
+    obs_property_t *analyzer = obs_properties_add_list(
+        props, "analyzer", "Analyzer",
+        OBS_COMBO_TYPE_LIST, OBS_COMBO_FORMAT_STRING);
+    obs_property_list_add_string(analyzer, "Automatic (first FPS Analyzer filter)", "");
+    char names[FPS_SHARED_MAX_CHANNELS][FPS_SHARED_NAME_MAX];
+    int name_count = fps_shared_list(names, FPS_SHARED_MAX_CHANNELS);
+    bool selected_listed = false;
+    const char *selected = data ? ((struct fps_overlay_source *)data)->analyzer : "";
+    for (int i = 0; i < name_count; i++)
+    {
+        obs_property_list_add_string(analyzer, names[i], names[i]);
+        if (strcmp(names[i], selected) == 0)
+            selected_listed = true;
+    }
+    // Keep a selection whose filter is not running (yet)
+    if (selected[0] && !selected_listed)
+        obs_property_list_add_string(analyzer, selected, selected);
+
     obs_property_t *font = obs_properties_add_list(
         props, "font_size", "Font size",
         OBS_COMBO_TYPE_LIST, OBS_COMBO_FORMAT_INT);
@@ -478,6 +658,14 @@ static obs_properties_t *fps_overlay_properties(void *data)
     obs_properties_add_bool(props, "show_fps_text", "Show FPS text");
     obs_properties_add_bool(props, "show_frametime_text", "Show Frametime text");
     obs_properties_add_bool(props, "show_tearing_text", "Show Tearing warning");
+    obs_property_t *lows_toggle = obs_properties_add_bool(props, "show_lows_text", "Show 1% / 0.1% lows and percentiles");
+    obs_property_set_modified_callback(lows_toggle, graph_toggle_modified);
+    obs_property_t *lows_scope = obs_properties_add_list(
+        props, "lows_scope", "Lows over",
+        OBS_COMBO_TYPE_LIST, OBS_COMBO_FORMAT_INT);
+    obs_property_list_add_int(lows_scope, "Whole session", LOWS_SESSION);
+    obs_property_list_add_int(lows_scope, "Graph history", LOWS_RECENT);
+    obs_properties_add_bool(props, "show_pacing_text", "Show frame pacing");
     obs_properties_add_bool(props, "show_text_background", "Show text background");
 
     obs_property_t *ft_toggle = obs_properties_add_bool(props, "show_frametime_graph", "Show frametime graph");
@@ -496,6 +684,7 @@ static obs_properties_t *fps_overlay_properties(void *data)
     obs_property_list_add_float(ft_scale, "16.67 ms", 16.67);
     obs_property_list_add_float(ft_scale, "33.33 ms", 33.33);
     obs_property_list_add_float(ft_scale, "66.67 ms", 66.67);
+    obs_property_t *ft_tint = obs_properties_add_bool(props, "pacing_tint", "Tint frametime graph by frame pacing");
 
     obs_property_t *fps_toggle = obs_properties_add_bool(props, "show_fps_graph", "Show framerate graph");
     obs_property_set_modified_callback(fps_toggle, graph_toggle_modified);
@@ -519,18 +708,25 @@ static obs_properties_t *fps_overlay_properties(void *data)
     bool fps_on = data ? ((struct fps_overlay_source *)data)->show_fps_graph : false;
     obs_property_set_visible(ft_style, ft_on);
     obs_property_set_visible(ft_scale, ft_on);
+    obs_property_set_visible(ft_tint, ft_on);
     obs_property_set_visible(fps_style_prop, fps_on);
     obs_property_set_visible(fps_scale, fps_on);
+    obs_property_set_visible(lows_scope, data ? ((struct fps_overlay_source *)data)->show_lows_text : false);
 
     return props;
 }
 
 static void fps_overlay_get_defaults(obs_data_t *settings)
 {
+    obs_data_set_default_string(settings, "analyzer", "");
     obs_data_set_default_int(settings, "font_size", 32);
     obs_data_set_default_bool(settings, "show_fps_text", true);
     obs_data_set_default_bool(settings, "show_frametime_text", true);
     obs_data_set_default_bool(settings, "show_tearing_text", true);
+    obs_data_set_default_bool(settings, "show_lows_text", true);
+    obs_data_set_default_int(settings, "lows_scope", LOWS_SESSION);
+    obs_data_set_default_bool(settings, "show_pacing_text", true);
+    obs_data_set_default_bool(settings, "pacing_tint", true);
     obs_data_set_default_bool(settings, "show_text_background", true);
     obs_data_set_default_bool(settings, "show_frametime_graph", true);
     obs_data_set_default_int(settings, "frametime_style", GRAPH_STYLE_COMPACT);
@@ -543,6 +739,11 @@ static void fps_overlay_get_defaults(obs_data_t *settings)
 static void fps_overlay_update(void *data, obs_data_t *settings)
 {
     struct fps_overlay_source *ctx = (struct fps_overlay_source *)data;
+    const int old_font_size = ctx->font_size;
+    const bool old_background = ctx->show_text_background;
+    const double old_ft_scale = ctx->frametime_scale;
+    const double old_fps_scale = ctx->fps_scale;
+
     ctx->font_size = (int)obs_data_get_int(settings, "font_size");
     if (ctx->font_size <= 0)
         ctx->font_size = 32;
@@ -550,17 +751,23 @@ static void fps_overlay_update(void *data, obs_data_t *settings)
     ctx->show_fps_text = obs_data_get_bool(settings, "show_fps_text");
     ctx->show_frametime_text = obs_data_get_bool(settings, "show_frametime_text");
     ctx->show_tearing_text = obs_data_get_bool(settings, "show_tearing_text");
+    ctx->show_lows_text = obs_data_get_bool(settings, "show_lows_text");
+    ctx->lows_scope = (int)obs_data_get_int(settings, "lows_scope");
+    ctx->show_pacing_text = obs_data_get_bool(settings, "show_pacing_text");
+    ctx->pacing_tint = obs_data_get_bool(settings, "pacing_tint");
     ctx->show_frametime_graph = obs_data_get_bool(settings, "show_frametime_graph");
     ctx->frametime_style = (int)obs_data_get_int(settings, "frametime_style");
     ctx->show_fps_graph = obs_data_get_bool(settings, "show_fps_graph");
     ctx->fps_style = (int)obs_data_get_int(settings, "fps_style");
     ctx->frametime_scale = obs_data_get_double(settings, "frametime_scale");
     ctx->fps_scale = obs_data_get_double(settings, "fps_scale");
+    snprintf(ctx->analyzer, sizeof(ctx->analyzer), "%s", obs_data_get_string(settings, "analyzer"));
 
-    rebuild_grid_labels(ctx);
-
-    // Force re-render with new settings
-    update_text_source(ctx, ctx->last_text[0] ? ctx->last_text : "FPS: --");
+    // Only what the changed settings affect; toggles and styles need nothing
+    if (ctx->frametime_scale != old_ft_scale || ctx->fps_scale != old_fps_scale)
+        rebuild_grid_labels(ctx);
+    if (ctx->font_size != old_font_size || ctx->show_text_background != old_background)
+        ctx->fonts_dirty = true;
 }
 
 static void fps_overlay_tick(void *data, float seconds)
@@ -569,58 +776,132 @@ static void fps_overlay_tick(void *data, float seconds)
     struct fps_overlay_source *ctx = (struct fps_overlay_source *)data;
 
     char text[512];
+    ctx->channel = fps_shared_find(ctx->analyzer);
+    const struct fps_shared_data *shared = ctx->channel ? fps_shared_read(ctx->channel) : NULL;
+    int active_filters = fps_shared_active_filters();
 
-    if (g_fps_shared.active_filter_count <= 0)
+    if (active_filters <= 0)
     {
         snprintf(text, sizeof(text),
                  "No FPS Analyzer filter active.\n"
                  "Add the \"FPS Analyzer 0.4\" filter\n"
                  "to a video source to start.");
     }
-    else if (g_fps_shared.active_filter_count > 1)
+    else if (!shared)
     {
         snprintf(text, sizeof(text),
-                 "Warning: %d FPS Analyzer filters active.\n"
-                 "Use only one filter at a time\n"
-                 "for accurate results.",
-                 g_fps_shared.active_filter_count);
+                 "FPS Analyzer \"%s\" is not active.\n"
+                 "Pick another analyzer in the\n"
+                 "overlay properties.",
+                 ctx->analyzer[0] ? ctx->analyzer : "(automatic)");
     }
-    else if (g_fps_shared.unsupported_format >= 0)
+    else if (shared->unsupported_format >= 0)
     {
         snprintf(text, sizeof(text),
                  "Unsupported video format (id: %d).\n"
                  "Supported: NV12, I420, I422, I444,\n"
                  "YUY2, UYVY, BGRA, RGBA.",
-                 g_fps_shared.unsupported_format);
+                 shared->unsupported_format);
     }
     else
     {
         text[0] = '\0';
         int pos = 0;
         if (ctx->show_fps_text)
-            pos += snprintf(text + pos, sizeof(text) - pos, "FPS: %d", g_fps_shared.fps);
+            pos += snprintf(text + pos, sizeof(text) - pos, "FPS: %d", shared->fps);
         if (ctx->show_frametime_text)
         {
             if (pos > 0)
                 pos += snprintf(text + pos, sizeof(text) - pos, "\n");
-            pos += snprintf(text + pos, sizeof(text) - pos, "Frametime: %.2f ms", g_fps_shared.frametime_ms);
+            pos += snprintf(text + pos, sizeof(text) - pos, "Frametime: %.2f ms", shared->frametime_ms);
         }
-        if (ctx->show_tearing_text && g_fps_shared.tearing_detected)
+        if (ctx->show_lows_text)
+        {
+            const struct fa_frametime_stats *ft =
+                ctx->lows_scope == LOWS_RECENT ? &shared->recent_stats : &shared->session_stats;
+            if (pos > 0)
+                pos += snprintf(text + pos, sizeof(text) - pos, "\n");
+            if (ft->frames > 0)
+                pos += snprintf(text + pos, sizeof(text) - pos,
+                                "1%% low: %.1f | 0.1%% low: %.1f\n"
+                                "P50: %.2f ms | P99: %.2f ms",
+                                ft->low_1_fps, ft->low_01_fps, ft->p50_ms, ft->p99_ms);
+            else
+                pos += snprintf(text + pos, sizeof(text) - pos, "1%% low: -- | 0.1%% low: --");
+        }
+        if (ctx->show_pacing_text)
+        {
+            const struct fa_pacing_stats *p = &shared->pacing;
+            if (pos > 0)
+                pos += snprintf(text + pos, sizeof(text) - pos, "\n");
+            if (p->cadence_refreshes > 0)
+                pos += snprintf(text + pos, sizeof(text) - pos,
+                                "Pacing: %.0f fps @ %.0f Hz, %.0f%% even | Stutters: %llu",
+                                p->cadence_fps, p->refresh_hz, p->consistency,
+                                (unsigned long long)p->stutters);
+            else
+                pos += snprintf(text + pos, sizeof(text) - pos, "Pacing: --");
+        }
+        if (ctx->show_tearing_text && shared->tearing_detected)
         {
             if (pos > 0)
                 pos += snprintf(text + pos, sizeof(text) - pos, "\n");
             pos += snprintf(text + pos, sizeof(text) - pos, "Warning: Tearing detected");
         }
         if (pos == 0)
-            snprintf(text, sizeof(text), " "); // at least a space so text source has content
+            snprintf(text, sizeof(text), " "); // at least a space so the overlay keeps a size
     }
 
-    // Only update the text source if the text actually changed
+    // Glyph quads are only rebuilt when the text actually changed
     if (strcmp(text, ctx->last_text) != 0)
     {
         strncpy(ctx->last_text, text, sizeof(ctx->last_text));
         ctx->last_text[sizeof(ctx->last_text) - 1] = '\0';
-        update_text_source(ctx, text);
+        ctx->text_dirty = true;
+    }
+}
+
+static void count_draw_calls(struct fps_overlay_source *ctx, int draws)
+{
+    ctx->renders++;
+    ctx->draw_calls += (uint64_t)draws;
+    if (draws > ctx->max_draw_calls)
+        ctx->max_draw_calls = draws;
+}
+
+// Graphics thread. Acquires the fonts and creates the batches on first use,
+// switches the text font after a font setting changed and refills the text
+// batch when the text changed. Fonts come from the shared atlas cache, so
+// the label font is rasterized once for all overlays.
+static void overlay_prepare_text(struct fps_overlay_source *ctx)
+{
+    if (ctx->fonts_dirty)
+    {
+        fps_text_font_release(ctx->text_font);
+        ctx->text_font = NULL;
+        ctx->fonts_dirty = false;
+        ctx->text_dirty = true;
+    }
+    if (!ctx->text_font)
+    {
+        struct fps_text_style style = {ctx->font_size, 2, 1.0f, ctx->show_text_background ? 0.8f : 0.0f};
+        ctx->text_font = fps_text_font_acquire(&style);
+    }
+    if (!ctx->label_font)
+    {
+        struct fps_text_style style = {LABEL_FONT_SIZE, 1, 0.8f, 0.0f};
+        ctx->label_font = fps_text_font_acquire(&style);
+    }
+    if (!ctx->text_batch)
+        ctx->text_batch = fps_text_batch_create(TEXT_BATCH_GLYPHS);
+    if (!ctx->label_batch)
+        ctx->label_batch = fps_text_batch_create(LABEL_BATCH_GLYPHS);
+
+    if (ctx->text_dirty && ctx->text_batch && ctx->text_font)
+    {
+        fps_text_batch_clear(ctx->text_batch);
+        fps_text_batch_add(ctx->text_batch, ctx->text_font, 0.0f, 0.0f, ctx->last_text);
+        ctx->text_dirty = false;
     }
 }
 
@@ -628,28 +909,42 @@ static void fps_overlay_render(void *data, gs_effect_t *effect)
 {
     UNUSED_PARAMETER(effect);
     struct fps_overlay_source *ctx = (struct fps_overlay_source *)data;
-    int count = g_fps_shared.graph_count;
+    const struct fps_shared_data *shared = ctx->channel ? fps_shared_read(ctx->channel) : NULL;
+    int count = shared ? shared->graph_count : 0;
     bool any_graph = (ctx->show_frametime_graph || ctx->show_fps_graph) && count >= 2;
 
+    overlay_prepare_text(ctx);
+
+    gs_blend_state_push();
+    gs_reset_blend_state();
+    gs_enable_blending(true);
+    gs_blend_function(GS_BLEND_SRCALPHA, GS_BLEND_INVSRCALPHA);
+
     // 1. Render text at top with margin
-    bool any_text = ctx->show_fps_text || ctx->show_frametime_text || ctx->show_tearing_text;
+    bool any_text = overlay_has_text(ctx);
     uint32_t y_offset = 0;
-    if (any_text && ctx->text_source)
+    int draws = 0;
+    if (any_text)
     {
         gs_matrix_push();
         gs_matrix_translate3f(0.0f, (float)GRAPH_MARGIN, 0.0f);
-        obs_source_video_render(ctx->text_source);
+        draws += fps_text_batch_draw(ctx->text_batch, ctx->text_font);
         gs_matrix_pop();
-        y_offset = obs_source_get_height(ctx->text_source) + GRAPH_MARGIN * 2;
+        uint32_t text_w, text_h;
+        fps_text_measure(ctx->font_size, ctx->last_text, &text_w, &text_h);
+        y_offset = text_h + GRAPH_MARGIN * 2;
     }
 
     if (!any_graph)
+    {
+        gs_blend_state_pop();
+        count_draw_calls(ctx, draws);
         return;
+    }
 
-    gs_blend_state_push();
-    gs_reset_blend_state();
-    gs_enable_blending(true);
-    gs_blend_function(GS_BLEND_SRCALPHA, GS_BLEND_INVSRCALPHA);
+    // Titles and grid labels of both graphs, drawn after the graphs
+    if (ctx->label_batch)
+        fps_text_batch_clear(ctx->label_batch);
 
     // 2. Frametime graph
     if (ctx->show_frametime_graph)
@@ -658,20 +953,23 @@ static void fps_overlay_render(void *data, gs_effect_t *effect)
         gs_matrix_translate3f(0.0f, (float)y_offset, 0.0f);
         double ft_step = (ctx->frametime_scale > 33.33) ? 16.67 : 8.33;
 
-        render_line_graph(g_fps_shared.graph_frametimes, count,
-                          ft_step, true, false, 16.67, 33.33,
-                          ctx->frametime_scale,
-                          ctx->ft_grid_labels, ctx->ft_grid_values, ctx->ft_grid_count,
-                          ctx->frametime_style);
-        // Title label
-        if (ctx->label_frametime)
+        draws += render_line_graph(&ctx->ft_batch, shared->graph_frametimes, FA_SMOOTHED_UNITS_PER_MS,
+                                   shared->graph_tearing, ctx->pacing_tint ? shared->graph_pacing : NULL,
+                                   count, shared->graph_length,
+                                   ft_step, true, false, 16.67, 33.33,
+                                   ctx->frametime_scale, shared->range.frametime_max_ms,
+                                   ctx->ft_grid_text, ctx->ft_grid_values, ctx->ft_grid_count,
+                                   ctx->label_batch, ctx->label_font, (float)y_offset,
+                                   ctx->frametime_style);
+        gs_matrix_pop();
+        // Title label with the recent peak, the spike a smoothed line hides
+        if (ctx->label_batch && ctx->label_font)
         {
-            gs_matrix_push();
-            gs_matrix_translate3f((float)GRAPH_MARGIN, 2.0f, 0.0f);
-            obs_source_video_render(ctx->label_frametime);
-            gs_matrix_pop();
+            char title[GRAPH_TITLE_LEN];
+            snprintf(title, sizeof(title), "FRAMETIME  peak %.1f ms", shared->range.peak_ms);
+            fps_text_batch_add(ctx->label_batch, ctx->label_font, (float)GRAPH_MARGIN,
+                               (float)y_offset + 2.0f, title);
         }
-        gs_matrix_pop();
         {
             int pw, ph, tw, th;
             get_graph_dims(ctx->frametime_style, &pw, &ph, &tw, &th);
@@ -695,32 +993,43 @@ static void fps_overlay_render(void *data, gs_effect_t *effect)
         else
             fps_step = 10.0; // auto: every 10 FPS
 
-        render_line_graph(g_fps_shared.graph_fps, count,
-                          fps_step, true, true, 60.0, 30.0,
-                          ctx->fps_scale,
-                          ctx->fps_grid_labels, ctx->fps_grid_values, ctx->fps_grid_count,
-                          ctx->fps_style);
-        // Title label
-        if (ctx->label_fps)
+        draws += render_line_graph(&ctx->fps_batch, shared->graph_fps, 1.0, shared->graph_tearing, NULL,
+                                   count, shared->graph_length,
+                                   fps_step, true, true, 60.0, 30.0,
+                                   ctx->fps_scale, shared->range.fps_max,
+                                   ctx->fps_grid_text, ctx->fps_grid_values, ctx->fps_grid_count,
+                                   ctx->label_batch, ctx->label_font, (float)y_offset,
+                                   ctx->fps_style);
+        gs_matrix_pop();
+        // Title label with the range of the history
+        if (ctx->label_batch && ctx->label_font)
         {
-            gs_matrix_push();
-            gs_matrix_translate3f((float)GRAPH_MARGIN, 2.0f, 0.0f);
-            obs_source_video_render(ctx->label_fps);
-            gs_matrix_pop();
+            char title[GRAPH_TITLE_LEN];
+            snprintf(title, sizeof(title), "FRAMERATE  min %.0f / max %.0f", shared->range.fps_min,
+                     shared->range.fps_max);
+            fps_text_batch_add(ctx->label_batch, ctx->label_font, (float)GRAPH_MARGIN,
+                               (float)y_offset + 2.0f, title);
         }
-        gs_matrix_pop();
     }
 
+    // 4. All graph labels in one draw
+    draws += fps_text_batch_draw(ctx->label_batch, ctx->label_font);
+
     gs_blend_state_pop();
+    count_draw_calls(ctx, draws);
 }
 
 static uint32_t fps_overlay_get_width(void *data)
 {
     struct fps_overlay_source *ctx = (struct fps_overlay_source *)data;
-    bool any_text = ctx->show_fps_text || ctx->show_frametime_text || ctx->show_tearing_text;
+    bool any_text = overlay_has_text(ctx);
     uint32_t text_w = 0;
-    if (any_text && ctx->text_source)
-        text_w = obs_source_get_width(ctx->text_source) + GRAPH_MARGIN * 2;
+    if (any_text)
+    {
+        uint32_t text_h;
+        fps_text_measure(ctx->font_size, ctx->last_text, &text_w, &text_h);
+        text_w += GRAPH_MARGIN * 2;
+    }
     if (ctx->show_frametime_graph || ctx->show_fps_graph)
     {
         int pw, ph, tw, th;
@@ -745,10 +1054,14 @@ static uint32_t fps_overlay_get_width(void *data)
 static uint32_t fps_overlay_get_height(void *data)
 {
     struct fps_overlay_source *ctx = (struct fps_overlay_source *)data;
-    bool any_text = ctx->show_fps_text || ctx->show_frametime_text || ctx->show_tearing_text;
+    bool any_text = overlay_has_text(ctx);
     uint32_t text_h = 0;
-    if (any_text && ctx->text_source)
-        text_h = obs_source_get_height(ctx->text_source) + GRAPH_MARGIN * 2;
+    if (any_text)
+    {
+        uint32_t text_w;
+        fps_text_measure(ctx->font_size, ctx->last_text, &text_w, &text_h);
+        text_h += GRAPH_MARGIN * 2;
+    }
     int graphs = 0;
     if (ctx->show_frametime_graph)
         graphs++;
@@ -794,6 +1107,13 @@ bool obs_module_load(void)
 {
     obs_register_source(&fps_analyzer_filter_info);
     obs_register_source(&fps_overlay_source_info);
-    blog(LOG_INFO, "FPS Analyzer 0.4 loaded");
+    fa_kernels_init();
+    blog(LOG_INFO, "FPS Analyzer 0.4 loaded (analysis kernels: %s)",
+         fa_simd_level_name(fa_kernels_level()));
     return true;
 }
+
+void obs_module_unload(void)
+{
+    fps_shared_free_all();
+}
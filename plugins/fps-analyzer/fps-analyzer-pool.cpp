@@ -0,0 +1,113 @@
+#include "fps-analyzer-pool.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+struct fa_thread_pool {
+    std::vector<std::thread> threads;
+    std::mutex lock;
+    std::condition_variable wake;
+    std::condition_variable done;
+    bool stop = false;
+    uint64_t generation = 0;
+    // Current run, set under lock
+    void (*fn)(void *ctx, int task) = nullptr;
+    void *ctx = nullptr;
+    int tasks = 0;
+    std::atomic<int> next{0};
+    int busy = 0; // workers inside the current run's task loop
+};
+
+// Take tasks until none are left
+static void run_tasks(void (*fn)(void *, int), void *ctx, int tasks, std::atomic<int> *next)
+{
+    for (int t = next->fetch_add(1); t < tasks; t = next->fetch_add(1))
+        fn(ctx, t);
+}
+
+static void worker_main(struct fa_thread_pool *pool)
+{
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> guard(pool->lock);
+    for (;;) {
+        pool->wake.wait(guard, [&] { return pool->stop || pool->generation != seen; });
+        if (pool->stop)
+            return;
+        seen = pool->generation;
+        void (*fn)(void *, int) = pool->fn;
+        void *ctx = pool->ctx;
+        int tasks = pool->tasks;
+        pool->busy++;
+        guard.unlock();
+
+        run_tasks(fn, ctx, tasks, &pool->next);
+
+        guard.lock();
+        // Runs only reset the task counter when no worker is inside it
+        if (--pool->busy == 0)
+            pool->done.notify_all();
+    }
+}
+
+struct fa_thread_pool *fa_thread_pool_create(int threads)
+{
+    if (threads < 1)
+        return NULL;
+    fa_thread_pool *pool = new (std::nothrow) fa_thread_pool();
+    if (!pool)
+        return NULL;
+    try {
+        for (int i = 0; i < threads; ++i)
+            pool->threads.emplace_back(worker_main, pool);
+    } catch (...) {
+        fa_thread_pool_destroy(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+void fa_thread_pool_destroy(struct fa_thread_pool *pool)
+{
+    if (!pool)
+        return;
+    {
+        std::lock_guard<std::mutex> guard(pool->lock);
+        pool->stop = true;
+    }
+    pool->wake.notify_all();
+    for (std::thread &t : pool->threads)
+        t.join();
+    delete pool;
+}
+
+int fa_thread_pool_threads(const struct fa_thread_pool *pool)
+{
+    return (int)pool->threads.size();
+}
+
+void fa_thread_pool_run(struct fa_thread_pool *pool, int tasks,
+                        void (*fn)(void *ctx, int task), void *ctx)
+{
+    {
+        std::unique_lock<std::mutex> guard(pool->lock);
+        // A worker that woke up late for the previous run may still hold its
+        // task list; let it see the exhausted counter before resetting it
+        pool->done.wait(guard, [&] { return pool->busy == 0; });
+        pool->fn = fn;
+        pool->ctx = ctx;
+        pool->tasks = tasks;
+        pool->next.store(0);
+        pool->generation++;
+    }
+    pool->wake.notify_all();
+
+    run_tasks(fn, ctx, tasks, &pool->next);
+
+    // All indices are taken; wait for workers still running a task. Workers
+    // that wake up after this find no task left.
+    std::unique_lock<std::mutex> guard(pool->lock);
+    pool->done.wait(guard, [&] { return pool->busy == 0; });
+}
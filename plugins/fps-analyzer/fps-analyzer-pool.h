@@ -0,0 +1,20 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Small persistent worker pool for splitting one frame's analysis into row
+// bands. The threads sleep between frames; fa_thread_pool_run() wakes them,
+// runs the tasks on them and on the calling thread, and returns when all
+// tasks are done. One run at a time per pool.
+
+struct fa_thread_pool;
+
+// threads: workers besides the calling thread (>= 1)
+struct fa_thread_pool *fa_thread_pool_create(int threads);
+void fa_thread_pool_destroy(struct fa_thread_pool *pool);
+int fa_thread_pool_threads(const struct fa_thread_pool *pool);
+
+// Call fn(ctx, task) for task = 0..tasks-1, in any order and on any thread
+void fa_thread_pool_run(struct fa_thread_pool *pool, int tasks,
+                        void (*fn)(void *ctx, int task), void *ctx);
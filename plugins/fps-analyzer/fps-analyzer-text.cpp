@@ -0,0 +1,449 @@
+#include <obs-module.h>
+#include <graphics/graphics.h>
+#include <math.h>
+#include <string.h>
+
+#include "fps-analyzer-text.h"
+#include "fps-analyzer-font.h"
+
+#define ATLAS_WIDTH 1024
+#define ATLAS_GAP 1    // empty texels between cells, keeps linear filtering clean
+#define SOLID_CELL 4   // opaque black cell for background boxes
+#define GLYPH_COUNT (FONT_LAST - FONT_FIRST + 1)
+#define FONT_CACHE_MAX 8 // atlases kept, in use or not
+
+struct atlas_cell {
+    float u0, v0, u1, v1;
+    int x, y; // quad offset from the pen / line top, pixels
+    int w, h;
+};
+
+struct fps_text_font {
+    struct fps_text_style style;
+    gs_texture_t *texture;
+    struct atlas_cell cells[GLYPH_COUNT];
+    float solid_u, solid_v; // centre of the background cell
+    float advance;          // pixels per character
+    int line_height;
+};
+
+struct font_cache_entry {
+    struct fps_text_font *font;
+    int refs;
+    uint64_t released; // release order of unused entries, oldest is evicted first
+};
+
+// Graphics thread only
+static struct font_cache_entry font_cache[FONT_CACHE_MAX];
+static uint64_t font_cache_clock;
+
+struct fps_text_batch {
+    gs_vertbuffer_t *vb;
+    uint32_t max_glyphs; // quads, background boxes included
+    uint32_t used;       // vertices written since the last clear
+    bool dirty;          // changed since the last upload
+};
+
+// --- Distance field ---
+
+static int b64_value(char c)
+{
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+}
+
+// Decoded on first use; graphics thread only
+static const uint8_t *font_field(void)
+{
+    static uint8_t field[FONT_FIELD_SIZE];
+    static bool decoded = false;
+    if (decoded)
+        return field;
+
+    uint32_t bits = 0;
+    int nbits = 0;
+    size_t out = 0;
+    for (const char *p = font_field_b64; *p && out < FONT_FIELD_SIZE; p++) {
+        int v = b64_value(*p);
+        if (v < 0)
+            continue; // padding
+        bits = (bits << 6) | (uint32_t)v;
+        nbits += 6;
+        if (nbits >= 8) {
+            nbits -= 8;
+            field[out++] = (uint8_t)(bits >> nbits);
+        }
+    }
+    decoded = true;
+    return field;
+}
+
+// Bilinear sample of a glyph's field at (fx, fy), in samples; outside = far out
+static float field_sample(const uint8_t *samples, int w, int h, float fx, float fy)
+{
+    int x0 = (int)floorf(fx), y0 = (int)floorf(fy);
+    float tx = fx - x0, ty = fy - y0;
+    float v[4];
+    for (int i = 0; i < 4; i++) {
+        int x = x0 + (i & 1), y = y0 + (i >> 1);
+        v[i] = (x < 0 || y < 0 || x >= w || y >= h) ? 0.0f : (float)samples[y * w + x];
+    }
+    float top = v[0] + (v[1] - v[0]) * tx;
+    float bottom = v[2] + (v[3] - v[2]) * tx;
+    return top + (bottom - top) * ty;
+}
+
+static inline float clamp01(float v)
+{
+    return v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+}
+
+// --- Font atlas ---
+
+static struct fps_text_style normalized_style(const struct fps_text_style *style)
+{
+    struct fps_text_style s = *style;
+    if (s.size < 4)
+        s.size = 4;
+    if (s.outline < 0)
+        s.outline = 0;
+    return s;
+}
+
+static struct fps_text_font *font_create(const struct fps_text_style *style)
+{
+    struct fps_text_font *font = (struct fps_text_font *)bzalloc(sizeof(struct fps_text_font));
+    font->style = *style;
+    const float scale = (float)font->style.size / FONT_EM;
+    font->advance = FONT_ADVANCE * scale;
+    font->line_height = (int)ceilf((FONT_ASCENT + FONT_DESCENT) * scale);
+
+    // Shelf packing: glyph cells left to right, the solid cell first
+    int x = SOLID_CELL + ATLAS_GAP, y = 0, shelf = SOLID_CELL;
+    for (int i = 0; i < GLYPH_COUNT; i++) {
+        const struct font_glyph *g = &font_glyphs[i];
+        struct atlas_cell *cell = &font->cells[i];
+        cell->w = (int)ceilf(g->w * scale);
+        cell->h = (int)ceilf(g->h * scale);
+        cell->x = (int)floorf((g->x - FONT_PAD) * scale + 0.5f);
+        cell->y = (int)floorf((g->y - FONT_PAD) * scale + 0.5f);
+        if (x + cell->w > ATLAS_WIDTH) {
+            x = 0;
+            y += shelf + ATLAS_GAP;
+            shelf = 0;
+        }
+        cell->u0 = (float)x; // texels for now, normalized below
+        cell->v0 = (float)y;
+        x += cell->w + ATLAS_GAP;
+        if (cell->h > shelf)
+            shelf = cell->h;
+    }
+    const int atlas_h = y + shelf;
+
+    uint8_t *pixels = (uint8_t *)bzalloc((size_t)ATLAS_WIDTH * atlas_h * 4);
+    const float opacity = clamp01(font->style.opacity);
+    const float outline = (float)font->style.outline;
+    const float to_pixels = FONT_RANGE / 127.0f * scale; // field units -> output pixels
+    const uint8_t *field = font_field();
+
+    for (int sy = 0; sy < SOLID_CELL; sy++)
+        for (int sx = 0; sx < SOLID_CELL; sx++)
+            pixels[((size_t)sy * ATLAS_WIDTH + sx) * 4 + 3] = (uint8_t)(clamp01(font->style.background) * 255.0f + 0.5f);
+
+    for (int i = 0; i < GLYPH_COUNT; i++) {
+        const struct font_glyph *g = &font_glyphs[i];
+        const struct atlas_cell *cell = &font->cells[i];
+        const uint8_t *samples = field + g->offset;
+        for (int py = 0; py < cell->h; py++) {
+            uint8_t *row = pixels + ((size_t)(cell->v0 + py) * ATLAS_WIDTH + (size_t)cell->u0) * 4;
+            for (int px = 0; px < cell->w; px++) {
+                // Texel centre in field samples (sample k is centred at k + 0.5)
+                float fx = (px + 0.5f) / scale - 0.5f;
+                float fy = (py + 0.5f) / scale - 0.5f;
+                float d = (128.0f - field_sample(samples, g->w, g->h, fx, fy)) * to_pixels;
+                float glyph = clamp01(0.5f - d);
+                float edge = clamp01(0.5f + outline - d);
+                float alpha = outline > 0.0f ? edge : glyph;
+                float white = alpha > 0.0f ? glyph / alpha : 0.0f;
+                uint8_t c = (uint8_t)(white * 255.0f + 0.5f);
+                row[px * 4 + 0] = c;
+                row[px * 4 + 1] = c;
+                row[px * 4 + 2] = c;
+                row[px * 4 + 3] = (uint8_t)(alpha * opacity * 255.0f + 0.5f);
+            }
+        }
+    }
+
+    for (int i = 0; i < GLYPH_COUNT; i++) {
+        struct atlas_cell *cell = &font->cells[i];
+        cell->u1 = (cell->u0 + cell->w) / ATLAS_WIDTH;
+        cell->v1 = (cell->v0 + cell->h) / atlas_h;
+        cell->u0 /= ATLAS_WIDTH;
+        cell->v0 /= atlas_h;
+    }
+    font->solid_u = SOLID_CELL * 0.5f / ATLAS_WIDTH;
+    font->solid_v = SOLID_CELL * 0.5f / atlas_h;
+
+    const uint8_t *data = pixels;
+    font->texture = gs_texture_create(ATLAS_WIDTH, (uint32_t)atlas_h, GS_RGBA, 1, &data, 0);
+    bfree(pixels);
+    if (!font->texture) {
+        bfree(font);
+        return NULL;
+    }
+    return font;
+}
+
+static void font_destroy(struct fps_text_font *font)
+{
+    gs_texture_destroy(font->texture);
+    bfree(font);
+}
+
+static bool same_style(const struct fps_text_style *a, const struct fps_text_style *b)
+{
+    return a->size == b->size && a->outline == b->outline && a->opacity == b->opacity &&
+           a->background == b->background;
+}
+
+// A free slot, else the unused entry released longest ago, else NULL
+static struct font_cache_entry *font_cache_slot(void)
+{
+    struct font_cache_entry *oldest = NULL;
+    for (int i = 0; i < FONT_CACHE_MAX; i++) {
+        struct font_cache_entry *e = &font_cache[i];
+        if (!e->font)
+            return e;
+        if (e->refs == 0 && (!oldest || e->released < oldest->released))
+            oldest = e;
+    }
+    return oldest;
+}
+
+struct fps_text_font *fps_text_font_acquire(const struct fps_text_style *style)
+{
+    const struct fps_text_style s = normalized_style(style);
+    for (int i = 0; i < FONT_CACHE_MAX; i++) {
+        struct font_cache_entry *e = &font_cache[i];
+        if (e->font && same_style(&e->font->style, &s)) {
+            e->refs++;
+            return e->font;
+        }
+    }
+
+    struct font_cache_entry *slot = font_cache_slot();
+    struct fps_text_font *font = font_create(&s);
+    if (!font)
+        return NULL;
+    if (!slot)
+        return font; // every cached atlas in use: owned by the caller alone
+    if (slot->font)
+        font_destroy(slot->font);
+    slot->font = font;
+    slot->refs = 1;
+    return font;
+}
+
+void fps_text_font_release(struct fps_text_font *font)
+{
+    if (!font)
+        return;
+    for (int i = 0; i < FONT_CACHE_MAX; i++) {
+        if (font_cache[i].font == font) {
+            if (--font_cache[i].refs == 0)
+                font_cache[i].released = ++font_cache_clock;
+            return;
+        }
+    }
+    font_destroy(font);
+}
+
+void fps_text_font_cache_free(void)
+{
+    for (int i = 0; i < FONT_CACHE_MAX; i++) {
+        struct font_cache_entry *e = &font_cache[i];
+        if (e->font && e->refs == 0) {
+            font_destroy(e->font);
+            e->font = NULL;
+        }
+    }
+}
+
+const struct fps_text_style *fps_text_font_style(const struct fps_text_font *font)
+{
+    return &font->style;
+}
+
+// --- Layout ---
+
+// Glyph index of the character at *p and the length of its UTF-8 sequence
+static int next_glyph(const char *p, int *len)
+{
+    unsigned char c = (unsigned char)*p;
+    *len = 1;
+    if (c >= 0x80) {
+        while ((((unsigned char)p[*len]) & 0xC0) == 0x80)
+            (*len)++;
+        return '?' - FONT_FIRST;
+    }
+    if (c < FONT_FIRST || c > FONT_LAST)
+        return '?' - FONT_FIRST;
+    return c - FONT_FIRST;
+}
+
+static void text_extent(const char *text, int *columns, int *lines)
+{
+    int col = 0, max_col = 0, n = 1;
+    for (const char *p = text; *p;) {
+        if (*p == '\n') {
+            n++;
+            col = 0;
+            p++;
+            continue;
+        }
+        int len;
+        next_glyph(p, &len);
+        p += len;
+        if (++col > max_col)
+            max_col = col;
+    }
+    *columns = max_col;
+    *lines = n;
+}
+
+void fps_text_measure(int size, const char *text, uint32_t *width, uint32_t *height)
+{
+    if (size < 4)
+        size = 4;
+    const float scale = (float)size / FONT_EM;
+    int columns, lines;
+    text_extent(text, &columns, &lines);
+    *width = (uint32_t)ceilf(columns * FONT_ADVANCE * scale);
+    *height = (uint32_t)(lines * (int)ceilf((FONT_ASCENT + FONT_DESCENT) * scale));
+}
+
+// --- Batches ---
+
+struct fps_text_batch *fps_text_batch_create(uint32_t max_glyphs)
+{
+    struct fps_text_batch *batch = (struct fps_text_batch *)bzalloc(sizeof(struct fps_text_batch));
+    uint32_t verts = max_glyphs * 6;
+    struct gs_vb_data *vbd = gs_vbdata_create();
+    vbd->num = verts;
+    vbd->points = (struct vec3 *)bzalloc(sizeof(struct vec3) * verts);
+    vbd->num_tex = 1;
+    vbd->tvarray = (struct gs_tvertarray *)bzalloc(sizeof(struct gs_tvertarray));
+    vbd->tvarray[0].width = 2;
+    vbd->tvarray[0].array = bzalloc(sizeof(struct vec2) * verts);
+    batch->vb = gs_vertexbuffer_create(vbd, GS_DYNAMIC);
+    if (!batch->vb) {
+        bfree(batch);
+        return NULL;
+    }
+    batch->max_glyphs = max_glyphs;
+    return batch;
+}
+
+void fps_text_batch_destroy(struct fps_text_batch *batch)
+{
+    if (!batch)
+        return;
+    gs_vertexbuffer_destroy(batch->vb);
+    bfree(batch);
+}
+
+void fps_text_batch_clear(struct fps_text_batch *batch)
+{
+    batch->used = 0;
+    batch->dirty = true;
+}
+
+static void batch_quad(struct fps_text_batch *batch, float x, float y, float w, float h,
+                       float u0, float v0, float u1, float v1)
+{
+    if (batch->used + 6 > batch->max_glyphs * 6)
+        return;
+    struct gs_vb_data *vbd = gs_vertexbuffer_get_data(batch->vb);
+    struct vec3 *p = vbd->points + batch->used;
+    struct vec2 *t = (struct vec2 *)vbd->tvarray[0].array + batch->used;
+    const float xs[6] = {x, x + w, x, x, x + w, x + w};
+    const float ys[6] = {y, y, y + h, y + h, y, y + h};
+    const float us[6] = {u0, u1, u0, u0, u1, u1};
+    const float vs[6] = {v0, v0, v1, v1, v0, v1};
+    for (int i = 0; i < 6; i++) {
+        p[i].x = xs[i];
+        p[i].y = ys[i];
+        p[i].z = 0.0f;
+        t[i].x = us[i];
+        t[i].y = vs[i];
+    }
+    batch->used += 6;
+    batch->dirty = true;
+}
+
+void fps_text_batch_add(struct fps_text_batch *batch, const struct fps_text_font *font,
+                        float x, float y, const char *text)
+{
+    if (font->style.background > 0.0f) {
+        uint32_t w, h;
+        fps_text_measure(font->style.size, text, &w, &h);
+        batch_quad(batch, x, y, (float)w, (float)h, font->solid_u, font->solid_v, font->solid_u, font->solid_v);
+    }
+
+    float line_y = floorf(y + 0.5f);
+    int col = 0;
+    for (const char *p = text; *p;) {
+        if (*p == '\n') {
+            line_y += font->line_height;
+            col = 0;
+            p++;
+            continue;
+        }
+        int len;
+        int glyph = next_glyph(p, &len);
+        p += len;
+        const struct atlas_cell *cell = &font->cells[glyph];
+        float pen = floorf(x + col * font->advance + 0.5f);
+        col++;
+        if (cell->w == 0 || cell->h == 0)
+            continue; // space
+        batch_quad(batch, pen + cell->x, line_y + cell->y, (float)cell->w, (float)cell->h,
+                   cell->u0, cell->v0, cell->u1, cell->v1);
+    }
+}
+
+int fps_text_batch_draw(struct fps_text_batch *batch, const struct fps_text_font *font)
+{
+    if (!batch || !font || batch->used == 0)
+        return 0;
+    gs_effect_t *effect = obs_get_base_effect(OBS_EFFECT_DEFAULT);
+    if (!effect)
+        return 0;
+    gs_eparam_t *image = gs_effect_get_param_by_name(effect, "image");
+    gs_technique_t *tech = gs_effect_get_technique(effect, "Draw");
+    if (!image || !tech)
+        return 0;
+
+    gs_effect_set_texture(image, font->texture);
+    if (batch->dirty) {
+        // Only the vertices in use: flushing copies vbd->num of them
+        struct gs_vb_data *vbd = gs_vertexbuffer_get_data(batch->vb);
+        vbd->num = batch->used;
+        gs_vertexbuffer_flush(batch->vb);
+        vbd->num = batch->max_glyphs * 6;
+        batch->dirty = false;
+    }
+    gs_load_vertexbuffer(batch->vb);
+    gs_load_indexbuffer(NULL);
+    gs_technique_begin(tech);
+    gs_technique_begin_pass(tech, 0);
+    gs_draw(GS_TRIS, 0, batch->used);
+    gs_technique_end_pass(tech);
+    gs_technique_end(tech);
+    gs_load_vertexbuffer(NULL);
+    return 1;
+}
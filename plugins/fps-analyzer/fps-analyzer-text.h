@@ -0,0 +1,48 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// Overlay text without text sources. Printable ASCII is rasterized once per
+// style into a texture atlas from the built-in distance field font
+// (fps-analyzer-font.h, monospaced), then strings are drawn as textured
+// quads: white glyphs with a black outline, like the former text_gdiplus
+// sources. Other characters are drawn as '?'.
+// Everything except fps_text_measure() runs on the graphics thread.
+
+struct fps_text_style {
+    int size;         // em height in pixels
+    int outline;      // black outline in pixels, 0 = none
+    float opacity;    // of glyphs and outline, 0..1
+    float background; // opacity of a black box behind each string, 0 = none
+};
+
+struct fps_text_font;
+
+// Fonts are shared by style: acquire returns the cached atlas of an equal
+// style or rasterizes a new one, NULL if the texture cannot be created.
+// Released atlases stay cached, so switching a setting back costs nothing,
+// until a new style needs their slot.
+struct fps_text_font *fps_text_font_acquire(const struct fps_text_style *style);
+void fps_text_font_release(struct fps_text_font *font);
+// Frees the cached atlases no longer in use. Called when an overlay is
+// removed: libobs shuts graphics down before modules are unloaded.
+void fps_text_font_cache_free(void);
+const struct fps_text_style *fps_text_font_style(const struct fps_text_font *font);
+
+// Size of the box text takes at a font size: longest line x number of lines
+void fps_text_measure(int size, const char *text, uint32_t *width, uint32_t *height);
+
+// Strings of one font collected for a single draw call
+struct fps_text_batch;
+
+struct fps_text_batch *fps_text_batch_create(uint32_t max_glyphs);
+void fps_text_batch_destroy(struct fps_text_batch *batch);
+void fps_text_batch_clear(struct fps_text_batch *batch);
+// text with its top-left corner at x, y; '\n' starts a new line. Glyphs
+// beyond the batch capacity are dropped.
+void fps_text_batch_add(struct fps_text_batch *batch, const struct fps_text_font *font,
+                        float x, float y, const char *text);
+// Draws at the current matrix, blending as set by the caller; a NULL batch
+// or font draws nothing. Returns the number of draw calls issued (0 or 1).
+// The vertices are uploaded again only after a clear or add.
+int fps_text_batch_draw(struct fps_text_batch *batch, const struct fps_text_font *font);
@@ -1,25 +1,96 @@
 #pragma once
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include "fps-analyzer-api.h"
 
-#define FPS_GRAPH_HISTORY 960
+#define FPS_SHARED_MAX_CHANNELS 8
+#define FPS_SHARED_NAME_MAX 256
+#define FPS_SHARED_CACHE_LINE 64
 
-// Shared data between FPS Analyzer filter and source.
-// Both run on OBS's video thread (video_tick), so no mutex needed.
-struct fps_shared_data {
+// Shared data between FPS Analyzer filters and overlay sources.
+//
+// Every filter instance registers a channel in a small registry and
+// publishes through the channel's lock-free triple buffer: the writer
+// (filter video_tick) fills the back buffer and swaps it with the middle
+// one; a reader (overlay tick/render, graphics thread) swaps the middle
+// buffer to the front only when a newer one was published. Readers never
+// block the writer and always see one complete snapshot, without copying it.
+// Single writer thread and single reader thread per channel: video_tick and
+// source render callbacks all run on OBS's graphics thread today.
+//
+// The registry holds at most FPS_SHARED_MAX_CHANNELS channels. A channel's
+// buffers are allocated the first time its slot is used and kept until the
+// module unloads, so a channel pointer never dangles; slots are reused by
+// later filters. Reuse leaves the triple buffer to the readers as it was:
+// until the new filter publishes, they keep seeing the previous filter's
+// last snapshot.
+//
+// A snapshot is a header of scalars and summaries, on cache lines of its
+// own so the writer filling the back buffer and the reader of the front
+// buffer never touch the same line, plus the graph arrays as a structure of
+// arrays in a separate block. Publishing writes and rendering reads only
+// the header and the first graph_count entries of each array.
+struct alignas(FPS_SHARED_CACHE_LINE) fps_shared_data {
     int fps;
     double frametime_ms;
     bool tearing_detected;
     uint64_t last_update_ns;
-    int active_filter_count;
     int unsupported_format; // -1 = ok, otherwise video_format enum value
-    // Graph data — linearized (oldest to newest), ready for rendering
-    double graph_frametimes[FPS_GRAPH_HISTORY];     // smoothed
-    double graph_frametimes_raw[FPS_GRAPH_HISTORY]; // raw (for future use)
-    double graph_fps[FPS_GRAPH_HISTORY];
-    bool graph_tearing[FPS_GRAPH_HISTORY];
+    // Percentiles and 1 % / 0.1 % lows: whole session and graph history
+    struct fa_frametime_stats session_stats;
+    struct fa_frametime_stats recent_stats;
+    struct fa_pacing_stats pacing;
+    struct fa_history_range range; // graph auto-scale and legend values
+    // Graph data — linearized (oldest to newest), ready for rendering, in
+    // the compact types of fa_copy_history(). Arrays of graph_capacity
+    // entries, each starting on a cache line of graph_block, sized by the
+    // writer with fps_shared_reserve().
+    uint16_t *graph_frametimes;     // smoothed, FA_SMOOTHED_UNITS_PER_MS per ms
+    uint16_t *graph_fps;
+    uint8_t *graph_pacing;          // fa_pace_t
+    uint8_t *graph_tearing;         // bitset, entry i is bit i & 7 of byte i / 8
+    uint32_t *graph_frametimes_raw; // raw, us; NULL unless reserved with_raw
     int graph_count;
+    int graph_length;   // entries of a full history: the graph's time span
+    int graph_capacity;
+    // Writer-owned allocation behind the arrays
+    void *graph_block;
+    size_t graph_block_bytes;
 };
 
-// Defined in fps-analyzer-filter.cpp
-extern struct fps_shared_data g_fps_shared;
+struct fps_shared_channel;
+
+// Implemented in fps-analyzer-filter.cpp
+
+// Writer: one channel per filter. NULL when all slots are taken.
+struct fps_shared_channel *fps_shared_register(void);
+void fps_shared_unregister(struct fps_shared_channel *channel);
+// Name shown in the overlay's analyzer list, "<source> / <filter>"
+void fps_shared_set_name(struct fps_shared_channel *channel, const char *name);
+// Buffer to fill completely, then make it visible with fps_shared_publish()
+struct fps_shared_data *fps_shared_begin_write(struct fps_shared_channel *channel);
+// Writer: size the graph arrays of the buffer being written for capacity
+// entries, with graph_frametimes_raw only if with_raw. The block grows but
+// is not shrunk, and is kept when a slot is reused; the array contents are
+// undefined afterwards.
+void fps_shared_reserve(struct fps_shared_data *data, int capacity, bool with_raw);
+void fps_shared_publish(struct fps_shared_channel *channel);
+
+// Reader: channel registered under name, or the oldest registered channel
+// for an empty name. NULL if there is none.
+struct fps_shared_channel *fps_shared_find(const char *name);
+// Latest published snapshot. Stays valid and unchanged until the next
+// fps_shared_read() of the same channel; do not keep the pointer across
+// callbacks.
+const struct fps_shared_data *fps_shared_read(struct fps_shared_channel *channel);
+// Names of the registered channels, oldest first; returns the count
+int fps_shared_list(char names[][FPS_SHARED_NAME_MAX], int max_names);
+
+// Number of FPS Analyzer filters alive (updated from create/destroy)
+int fps_shared_active_filters(void);
+// Bytes held by the registry (all channel buffers ever allocated, graph
+// arrays included)
+size_t fps_shared_memory_used(void);
+// Module unload: release every channel
+void fps_shared_free_all(void);
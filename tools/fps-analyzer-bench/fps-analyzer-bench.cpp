@@ -0,0 +1,320 @@
+// fps-analyzer-bench: time the analysis kernels and the per-frame analysis
+// steps at common capture resolutions and write the results as JSON.
+#include "fps-analyzer-core.h"
+#include "fps-analyzer-kernels.h"
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_BATCHES 5
+
+struct resolution {
+    const char *name;
+    uint32_t width;
+    uint32_t height;
+};
+
+static const struct resolution resolutions[] = {
+    {"720p", 1280, 720},
+    {"1080p", 1920, 1080},
+    {"1440p", 2560, 1440},
+    {"4K", 3840, 2160},
+};
+
+static const struct {
+    fa_pixel_format_t format;
+    const char *name;
+} formats[] = {
+    {FA_FORMAT_Y8, "Y8"},
+    {FA_FORMAT_YUY2, "YUY2"},
+    {FA_FORMAT_UYVY, "UYVY"},
+    {FA_FORMAT_BGRA, "BGRA"},
+    {FA_FORMAT_RGBA, "RGBA"},
+};
+
+static double g_min_batch_s = 0.02;
+static volatile size_t g_sink; // keeps results alive
+static FILE *g_out;
+static bool g_first_result = true;
+
+static double now_s(void)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Median ns per call of fn(i) over BENCH_BATCHES batches, each sized to
+// run for at least g_min_batch_s
+template <typename Fn>
+static double time_ns(Fn fn)
+{
+    uint64_t iters = 1;
+    for (;;) {
+        double t0 = now_s();
+        for (uint64_t i = 0; i < iters; ++i)
+            fn(i);
+        double dt = now_s() - t0;
+        if (dt >= g_min_batch_s / 4 || iters >= (1ULL << 30))
+            break;
+        iters *= 2;
+    }
+    iters = std::max<uint64_t>(1, iters * 4);
+
+    double batches[BENCH_BATCHES];
+    for (int b = 0; b < BENCH_BATCHES; ++b) {
+        double t0 = now_s();
+        for (uint64_t i = 0; i < iters; ++i)
+            fn(i);
+        batches[b] = (now_s() - t0) * 1e9 / (double)iters;
+    }
+    std::sort(batches, batches + BENCH_BATCHES);
+    return batches[BENCH_BATCHES / 2];
+}
+
+static void emit(const char *bench, const char *variant, const struct resolution *res,
+                 const char *format, double ns, double bytes)
+{
+    fprintf(g_out, "%s    {\"bench\": \"%s\", \"variant\": \"%s\", \"resolution\": \"%s\", "
+            "\"width\": %u, \"height\": %u, \"format\": \"%s\", "
+            "\"ns_per_frame\": %.1f, \"bytes_per_frame\": %.0f, \"gb_per_s\": %.3f}",
+            g_first_result ? "" : ",\n", bench, variant, res ? res->name : "",
+            res ? res->width : 0, res ? res->height : 0, format,
+            ns, bytes, ns > 0.0 ? bytes / ns : 0.0);
+    g_first_result = false;
+    fprintf(stderr, "%-18s %-8s %-6s %-5s %12.1f ns/frame %8.2f GB/s\n",
+            bench, variant, res ? res->name : "-", format, ns, ns > 0.0 ? bytes / ns : 0.0);
+}
+
+// Two frames that differ in ~1/3 of the bytes, like consecutive game frames
+static void fill_frames(uint8_t *a, uint8_t *b, size_t size)
+{
+    uint32_t x = 0x12345678u;
+    for (size_t i = 0; i < size; ++i) {
+        x = x * 1664525u + 1013904223u;
+        a[i] = (uint8_t)(x >> 24);
+        b[i] = ((x >> 8) % 3 == 0) ? (uint8_t)(a[i] + 1) : a[i];
+    }
+}
+
+// Row kernels over a whole frame, for every SIMD level this CPU supports
+static void bench_kernels(const struct resolution *res, uint8_t *a, uint8_t *b, uint8_t *luma)
+{
+    const uint32_t w = res->width, h = res->height;
+    const size_t pixels = (size_t)w * h;
+
+    for (int l = FA_SIMD_SCALAR; l <= FA_SIMD_NEON; ++l) {
+        fa_simd_level_t level = (fa_simd_level_t)l;
+        if (!fa_kernels_select(level))
+            continue;
+        const char *variant = fa_simd_level_name(level);
+        const struct fa_kernel_table k = fa_kernels;
+        double ns;
+
+        ns = time_ns([&](uint64_t) { g_sink = k.count_diff_bytes(a, b, pixels); });
+        emit("count_diff_bytes", variant, res, "Y8", ns, 2.0 * pixels);
+
+        ns = time_ns([&](uint64_t) { g_sink = k.count_diff_copy(a, b, luma, pixels); });
+        emit("count_diff_copy", variant, res, "Y8", ns, 3.0 * pixels);
+
+        ns = time_ns([&](uint64_t) {
+            for (uint32_t y = 0; y < h; ++y)
+                k.bgra_to_luma(a + (size_t)y * w * 4, luma + (size_t)y * w, w);
+            g_sink = luma[0];
+        });
+        emit("bgra_to_luma", variant, res, "BGRA", ns, 5.0 * pixels);
+
+        ns = time_ns([&](uint64_t) {
+            for (uint32_t y = 0; y < h; ++y)
+                k.rgba_to_luma(a + (size_t)y * w * 4, luma + (size_t)y * w, w);
+            g_sink = luma[0];
+        });
+        emit("rgba_to_luma", variant, res, "RGBA", ns, 5.0 * pixels);
+
+        ns = time_ns([&](uint64_t) {
+            for (uint32_t y = 0; y < h; ++y)
+                k.yuy2_to_luma(a + (size_t)y * w * 2, luma + (size_t)y * w, w);
+            g_sink = luma[0];
+        });
+        emit("yuy2_to_luma", variant, res, "YUY2", ns, 3.0 * pixels);
+
+        ns = time_ns([&](uint64_t) {
+            for (uint32_t y = 0; y < h; ++y)
+                k.uyvy_to_luma(a + (size_t)y * w * 2, luma + (size_t)y * w, w);
+            g_sink = luma[0];
+        });
+        emit("uyvy_to_luma", variant, res, "UYVY", ns, 3.0 * pixels);
+    }
+    fa_kernels_init();
+}
+
+// Whole detection step (luma extraction, diff, tearing) on alternating frames
+static void bench_detector(const struct resolution *res, uint8_t *a, uint8_t *b)
+{
+    static const struct {
+        analyze_method_t method;
+        const char *name;
+    } methods[] = {
+        {ANALYZE_LAST_LINE, "detect_last_line"},
+        {ANALYZE_DIFF, "detect_full"},
+        {ANALYZE_TILED, "detect_tiled"},
+        {ANALYZE_SAMPLED, "detect_sampled"},
+    };
+    const char *variant = fa_simd_level_name(fa_kernels_level());
+    for (size_t m = 0; m < sizeof(methods) / sizeof(methods[0]); ++m) {
+        analyze_method_t method = methods[m].method;
+        for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f) {
+            const uint32_t bpp = fa_pixel_format_bpp(formats[f].format);
+            const uint32_t linesize = res->width * bpp;
+            struct fa_detector det;
+            memset(&det, 0, sizeof(det));
+            det.analyze_method = method;
+            det.sensitivity = 0.1;
+            det.enable_tearing_detection = true;
+            det.tearing_sensitivity = 1.0;
+            det.sample_rows = 32;
+            det.sample_column_step = 1;
+
+            double ns = time_ns([&](uint64_t i) {
+                struct fa_frame_result result;
+                fa_detector_process(&det, formats[f].format, (i & 1) ? b : a, linesize,
+                                    res->width, res->height, &result);
+                g_sink = result.unique;
+            });
+            const double rows = method == ANALYZE_LAST_LINE ? 3 : method == ANALYZE_SAMPLED ? 32 + 3 : res->height;
+            emit(methods[m].name, variant, res, formats[f].name, ns, rows * linesize);
+            fa_detector_free(&det);
+        }
+    }
+
+    // Full frame split into row bands on 2, 4 and 8 threads
+    for (uint32_t threads = 2; threads <= 8; threads *= 2) {
+        if ((uint64_t)res->width * res->height < FA_MT_MIN_PIXELS)
+            break;
+        char name[32];
+        snprintf(name, sizeof(name), "detect_full_mt%u", threads);
+        for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f) {
+            const uint32_t linesize = res->width * fa_pixel_format_bpp(formats[f].format);
+            struct fa_detector det;
+            memset(&det, 0, sizeof(det));
+            det.analyze_method = ANALYZE_DIFF;
+            det.sensitivity = 0.1;
+            det.enable_tearing_detection = true;
+            det.tearing_sensitivity = 1.0;
+            det.analysis_threads = threads;
+
+            double ns = time_ns([&](uint64_t i) {
+                struct fa_frame_result result;
+                fa_detector_process(&det, formats[f].format, (i & 1) ? b : a, linesize,
+                                    res->width, res->height, &result);
+                g_sink = result.unique;
+            });
+            emit(name, variant, res, formats[f].name, ns, (double)res->height * linesize);
+            fa_detector_free(&det);
+        }
+    }
+}
+
+// Per-frame bookkeeping that does not depend on the resolution
+static void bench_steps(void)
+{
+    struct fa_detector det;
+    memset(&det, 0, sizeof(det));
+    det.enable_tearing_detection = true;
+    det.tearing_sensitivity = 1.0;
+    const size_t line_diff[2][3] = {{1000, 0, 0}, {1000, 1000, 1000}};
+    double ns = time_ns([&](uint64_t i) {
+        g_sink = fa_detect_tearing(&det, line_diff[i & 1], 1920);
+    });
+    emit("detect_tearing", "", NULL, "", ns, 0.0);
+
+    struct fa_stats *stats = (struct fa_stats *)calloc(1, sizeof(struct fa_stats));
+    struct fa_frame_result result;
+    memset(&result, 0, sizeof(result));
+    result.have_ref = true;
+    result.unique = true;
+    uint64_t ts = 1000000000ULL;
+    ns = time_ns([&](uint64_t) {
+        ts += 4166667ULL; // 240 fps
+        g_sink = fa_stats_push(stats, &result, ts);
+    });
+    emit("stats_push", "", NULL, "", ns, 0.0);
+    fa_stats_free(stats);
+    free(stats);
+}
+
+int main(int argc, char **argv)
+{
+    const char *output_path = NULL;
+    const char *label = "";
+    bool quick = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+            output_path = argv[++i];
+        else if (strcmp(argv[i], "--label") == 0 && i + 1 < argc)
+            label = argv[++i];
+        else if (strcmp(argv[i], "--quick") == 0)
+            quick = true;
+        else {
+            fprintf(stderr,
+                    "Usage: fps-analyzer-bench [--output FILE] [--label TEXT] [--quick]\n"
+                    "  --output FILE  write JSON to FILE (default: stdout)\n"
+                    "  --label TEXT   free-form tag stored in the JSON (commit, machine)\n"
+                    "  --quick        1080p only, shorter batches\n");
+            return 2;
+        }
+    }
+    if (quick)
+        g_min_batch_s = 0.005;
+
+    g_out = output_path ? fopen(output_path, "w") : stdout;
+    if (!g_out) {
+        fprintf(stderr, "Cannot write %s\n", output_path);
+        return 1;
+    }
+
+    fa_kernels_init();
+    fprintf(g_out, "{\n  \"tool\": \"fps-analyzer-bench\",\n  \"label\": \"");
+    for (const char *c = label; *c; ++c) {
+        if (*c == '"' || *c == '\\')
+            fputc('\\', g_out);
+        if ((unsigned char)*c >= 0x20)
+            fputc(*c, g_out);
+    }
+    fprintf(g_out, "\",\n  \"kernels\": \"%s\",\n  \"supported\": [", fa_simd_level_name(fa_kernels_level()));
+    bool first = true;
+    for (int l = FA_SIMD_SCALAR; l <= FA_SIMD_NEON; ++l) {
+        if (!fa_kernels_supported((fa_simd_level_t)l))
+            continue;
+        fprintf(g_out, "%s\"%s\"", first ? "" : ", ", fa_simd_level_name((fa_simd_level_t)l));
+        first = false;
+    }
+    fprintf(g_out, "],\n  \"results\": [\n");
+
+    // Largest frame: 4K BGRA
+    const size_t max_bytes = (size_t)3840 * 2160 * 4;
+    uint8_t *a = (uint8_t *)malloc(max_bytes);
+    uint8_t *b = (uint8_t *)malloc(max_bytes);
+    uint8_t *luma = (uint8_t *)malloc((size_t)3840 * 2160);
+    if (!a || !b || !luma) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+    fill_frames(a, b, max_bytes);
+
+    for (size_t r = 0; r < sizeof(resolutions) / sizeof(resolutions[0]); ++r) {
+        if (quick && resolutions[r].height != 1080)
+            continue;
+        bench_kernels(&resolutions[r], a, b, luma);
+        bench_detector(&resolutions[r], a, b);
+    }
+    bench_steps();
+
+    fprintf(g_out, "\n  ]\n}\n");
+    if (g_out != stdout)
+        fclose(g_out);
+    free(a);
+    free(b);
+    free(luma);
+    return 0;
+}
@@ -0,0 +1,219 @@
+// fps-analyzer-check: compare the analysis core's incremental and threaded
+// paths with straightforward reference computations on generated input.
+// Prints one line per check and exits with 1 if any of them fails.
+#include "fps-analyzer-core.h"
+#include "fps-analyzer-kernels.h"
+#include <algorithm>
+#include <math.h>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static bool g_quick = false;
+static uint64_t g_seed = 1;
+static int g_failed = 0;
+
+static void report(const char *check, long cases, long mismatches, const char *detail)
+{
+    printf("%-20s %8ld cases, %ld mismatches%s%s\n", check, cases, mismatches, detail[0] ? "  " : "", detail);
+    if (mismatches > 0)
+        g_failed++;
+}
+
+// Full frame diff split over a thread pool against the single-threaded loop:
+// same results and the same reference buffer, frame after frame
+static void check_full_frame_threads(void)
+{
+    static const fa_pixel_format_t formats[] = {FA_FORMAT_Y8, FA_FORMAT_BGRA, FA_FORMAT_UYVY};
+    static const uint32_t threads[] = {2, 5};
+    const int frames = g_quick ? 8 : 40;
+    // Above FA_MT_MIN_PIXELS, with an odd height and padded rows
+    const uint32_t width = 2000, height = 1111;
+    std::mt19937_64 rng(g_seed);
+    long cases = 0, bad = 0;
+
+    for (fa_pixel_format_t format : formats) {
+        for (uint32_t t : threads) {
+            uint32_t linesize = width * fa_pixel_format_bpp(format) + 64;
+            std::vector<uint8_t> frame((size_t)linesize * height);
+            struct fa_detector single = {}, multi = {};
+            single.analyze_method = multi.analyze_method = ANALYZE_DIFF;
+            single.sensitivity = multi.sensitivity = 0.5;
+            single.enable_tearing_detection = multi.enable_tearing_detection = true;
+            single.tearing_sensitivity = multi.tearing_sensitivity = 1.0;
+            single.analysis_threads = 1;
+            multi.analysis_threads = t;
+            for (int f = 0; f < frames; ++f) {
+                // From a static frame to a few % of changed bytes
+                int density = (int)(rng() % 5);
+                for (size_t i = 0; i < frame.size(); i += 1 + rng() % 64) {
+                    if ((int)(rng() % 100) < density * 5)
+                        frame[i] = (uint8_t)rng();
+                }
+                struct fa_frame_result a, b;
+                fa_detector_process(&single, format, frame.data(), linesize, width, height, &a);
+                fa_detector_process(&multi, format, frame.data(), linesize, width, height, &b);
+                cases++;
+                if (a.unique != b.unique || a.tearing != b.tearing || a.diff_percent != b.diff_percent ||
+                    memcmp(single.luma_frames[single.luma_cur ^ 1], multi.luma_frames[multi.luma_cur ^ 1],
+                           (size_t)width * height) != 0)
+                    bad++;
+            }
+            if (!multi.pool)
+                bad++; // never went multi-threaded: nothing was compared
+            fa_detector_free(&single);
+            fa_detector_free(&multi);
+        }
+    }
+    report("full_frame_threads", cases, bad, "");
+}
+
+// Histogram percentiles against an exact sort of lognormal frametimes with
+// occasional stalls. A bucket is at most 1/128 of its values wide and reports
+// its middle, so a percentile is within 1/256 of the exact value.
+static void check_percentiles(void)
+{
+    const int n = 200000;
+    std::mt19937_64 rng(g_seed);
+    std::lognormal_distribution<double> frametime_ms(log(8.0), 0.35);
+    static struct fa_ft_histogram hist;
+    std::vector<uint64_t> values;
+    values.reserve(n);
+    fa_ft_histogram_clear(&hist);
+    for (int i = 0; i < n; ++i) {
+        uint64_t ns = (uint64_t)(frametime_ms(rng) * 1e6);
+        if (i % 500 == 0)
+            ns *= 6;
+        values.push_back(ns);
+        fa_ft_histogram_add(&hist, ns);
+    }
+    struct fa_frametime_stats s;
+    fa_ft_histogram_summary(&hist, &s);
+    std::vector<uint64_t> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    const double q[5] = {0.5, 0.9, 0.95, 0.99, 0.999};
+    const double got[5] = {s.p50_ms, s.p90_ms, s.p95_ms, s.p99_ms, s.p999_ms};
+    long cases = 0, bad = 0;
+    double max_err = 0.0;
+    for (int i = 0; i < 5; ++i, ++cases) {
+        size_t rank = (size_t)ceil(q[i] * (double)n);
+        double exact = sorted[rank - 1] / 1e6;
+        double err = fabs(got[i] - exact) / exact;
+        max_err = std::max(max_err, err);
+        if (err > 1.0 / 256)
+            bad++;
+    }
+    double sum = 0.0;
+    for (uint64_t ns : values)
+        sum += (double)ns;
+    cases++;
+    if (s.frames != (uint64_t)n || fabs(s.avg_ms - sum / n / 1e6) > 1e-9)
+        bad++;
+
+    // Removing every value empties it again
+    for (uint64_t ns : values)
+        fa_ft_histogram_remove(&hist, ns);
+    bool empty = hist.count == 0 && hist.sum_ns == 0;
+    for (int i = 0; i < FA_FT_HIST_BUCKETS && empty; ++i)
+        empty = hist.buckets[i] == 0;
+    cases++;
+    if (!empty)
+        bad++;
+
+    char detail[64];
+    snprintf(detail, sizeof(detail), "max error %.2f %%", max_err * 100.0);
+    report("percentiles", cases, bad, detail);
+}
+
+// Sliding extremes and the linearized history against a scan of the ring
+// after every frame, through wrap-around, stalls, clears and length changes
+static void check_history(void)
+{
+    static const int lengths[] = {0, FA_HISTORY_MIN, FA_HISTORY_MAX, 333, FA_HISTORY_DEFAULT};
+    const int frames = g_quick ? 60000 : 300000;
+    const int phase = frames / 5;
+    std::mt19937_64 rng(g_seed);
+    struct fa_stats *stats = (struct fa_stats *)calloc(1, sizeof(struct fa_stats));
+    std::vector<uint16_t> smoothed(FA_HISTORY_MAX), fps(FA_HISTORY_MAX);
+    std::vector<uint32_t> raw(FA_HISTORY_MAX);
+    std::vector<uint8_t> tearing(FA_HISTORY_MAX / 8 + 1), pacing(FA_HISTORY_MAX);
+    uint64_t t = 1000;
+    long bad = 0;
+
+    for (int f = 0; f < frames; ++f) {
+        // 60 to 240 fps, with 80 ms hitches
+        t += 16666667ULL / (rng() % 4 + 1) + (rng() % 100 == 0 ? 80000000ULL : 0);
+        struct fa_frame_result r = {};
+        r.unique = rng() % 3 != 0;
+        r.tearing = rng() % 5 == 0;
+        fa_stats_push(stats, &r, t);
+        if (f % phase == phase - 1)
+            fa_stats_clear_history(stats);
+        if (f % phase == phase / 2)
+            fa_stats_set_history_length(stats, lengths[(f / phase) % 5]);
+
+        struct fa_history_range range;
+        fa_stats_range(stats, &range);
+        int n = fa_stats_copy_history(stats, smoothed.data(), raw.data(), fps.data(), tearing.data(),
+                                      pacing.data(), FA_HISTORY_MAX);
+        if (n != stats->frametime_count || range.count != n)
+            bad++;
+
+        double smin = 0.0, smax = 0.0, fmin = 0.0, fmax = 0.0, peak = 0.0;
+        for (int i = 0; i < stats->frametime_count; ++i) {
+            int s = (stats->frametime_pos - 1 - i + 2 * stats->history_size) % stats->history_size;
+            int c = n - 1 - i;
+            if (smoothed[c] != stats->smoothed[s] || raw[c] != stats->frametime_us[s] || fps[c] != stats->fps[s] ||
+                pacing[c] != stats->pacing_class[s] ||
+                (bool)((tearing[c >> 3] >> (c & 7)) & 1) != fa_stats_tearing_at(stats, s)) {
+                bad++;
+                break;
+            }
+            double sv = stats->smoothed[s] / (double)FA_SMOOTHED_UNITS_PER_MS;
+            double fv = stats->fps[s];
+            smin = i == 0 ? sv : std::min(smin, sv);
+            smax = i == 0 ? sv : std::max(smax, sv);
+            fmin = i == 0 ? fv : std::min(fmin, fv);
+            fmax = i == 0 ? fv : std::max(fmax, fv);
+            if ((uint32_t)(t / 1000) - stats->frame_end_us[s] <= FA_PEAK_WINDOW_NS / 1000)
+                peak = std::max(peak, stats->frametime_us[s] / 1000.0);
+        }
+        if (smin != range.frametime_min_ms || smax != range.frametime_max_ms || fmin != range.fps_min ||
+            fmax != range.fps_max || peak != range.peak_ms)
+            bad++;
+    }
+    fa_stats_free(stats);
+    free(stats);
+    report("history_extremes", frames, bad, "");
+}
+
+int main(int argc, char **argv)
+{
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--quick") == 0)
+            g_quick = true;
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            g_seed = strtoull(argv[++i], NULL, 10);
+        else {
+            fprintf(stderr,
+                    "Usage: fps-analyzer-check [--quick] [--seed N]\n"
+                    "  --quick   fewer frames per check\n"
+                    "  --seed N  random input seed (default 1)\n");
+            return 2;
+        }
+    }
+
+    fa_kernels_init();
+    check_full_frame_threads();
+    check_percentiles();
+    check_history();
+    if (g_failed) {
+        printf("%d check(s) failed\n", g_failed);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
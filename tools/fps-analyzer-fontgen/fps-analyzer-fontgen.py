@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+# Generates plugins/fps-analyzer/fps-analyzer-font.h: a signed distance field
+# of printable ASCII for the overlay's text renderer (fps-analyzer-text.cpp).
+#
+#   python3 fps-analyzer-fontgen.py SourceCodePro-Bold.ttf > fps-analyzer-font.h
+#
+# Needs Pillow and NumPy. The font must be monospaced: the renderer uses one
+# advance for every glyph.
+
+import base64
+import sys
+
+import numpy as np
+from PIL import Image, ImageDraw, ImageFont
+
+EM = 20        # distance field pixels per em
+SUPER = 8      # supersampling of the outlines the distances are measured on
+PAD = 3        # field pixels kept around the ink
+RANGE = 4.0    # distances are clamped to +-RANGE field pixels
+FIRST, LAST = 32, 126
+
+
+def glyph_field(font, ch, advance, ascent, descent):
+    w = int(np.ceil(advance)) + 2 * PAD
+    h = int(np.ceil(ascent + descent)) + 2 * PAD
+    img = Image.new("L", (w * SUPER, h * SUPER), 0)
+    ImageDraw.Draw(img).text((PAD * SUPER, (PAD + ascent) * SUPER), ch, font=font, fill=255, anchor="ls")
+    ink = np.asarray(img) >= 128
+
+    # Pixels on the ink boundary, both sides
+    edge = np.zeros_like(ink)
+    for axis in (0, 1):
+        for shift in (1, -1):
+            edge |= ink != np.roll(ink, shift, axis=axis)
+    ey, ex = np.nonzero(edge)
+
+    # Distance from each field sample centre to the nearest boundary pixel
+    ys = (np.arange(h) + 0.5) * SUPER - 0.5
+    xs = (np.arange(w) + 0.5) * SUPER - 0.5
+    dist = np.full((h, w), RANGE)
+    if len(ex):
+        for y in range(h):
+            d = np.sqrt((ex[None, :] - xs[:, None]) ** 2 + (ey[None, :] - ys[y]) ** 2).min(axis=1)
+            dist[y] = np.minimum((d - 0.5) / SUPER, RANGE)
+    inside = ink[ys.astype(int)][:, xs.astype(int)]
+    signed = np.where(inside, -dist, dist)
+
+    # 8-bit, 128 = on the outline, larger = inside
+    q = np.clip(np.round(128 - signed * (127 / RANGE)), 0, 255).astype(np.uint8)
+
+    # Keep the samples within PAD of the ink
+    rows = np.nonzero((signed < PAD).any(axis=1))[0]
+    cols = np.nonzero((signed < PAD).any(axis=0))[0]
+    if len(rows) == 0:
+        return 0, 0, 0, 0, b""
+    y0, y1, x0, x1 = rows[0], rows[-1] + 1, cols[0], cols[-1] + 1
+    return x0, y0, x1 - x0, y1 - y0, q[y0:y1, x0:x1].tobytes()
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: fps-analyzer-fontgen.py <monospaced font.ttf>")
+    font = ImageFont.truetype(sys.argv[1], EM * SUPER)
+    ascent, descent = (m / SUPER for m in font.getmetrics())
+    advance = font.getlength("0") / SUPER
+    family, style = font.getname()
+
+    glyphs, data = [], bytearray()
+    for c in range(FIRST, LAST + 1):
+        x, y, w, h, field = glyph_field(font, chr(c), advance, ascent, descent)
+        glyphs.append((x, y, w, h, len(data)))
+        data += field
+
+    b64 = base64.b64encode(bytes(data)).decode()
+    out = sys.stdout
+    out.write("#pragma once\n")
+    out.write("// Generated by tools/fps-analyzer-fontgen from %s %s. Do not edit.\n" % (family, style))
+    out.write("//\n")
+    out.write("// Source Code Pro: Copyright 2010, 2012 Adobe Systems Incorporated\n")
+    out.write("// (http://www.adobe.com/), with Reserved Font Name 'Source'. Licensed under\n")
+    out.write("// the SIL Open Font License, Version 1.1 (http://scripts.sil.org/OFL); see\n")
+    out.write("// fps-analyzer-font-OFL.txt for the full notice and license text.\n")
+    out.write("//\n")
+    out.write("// Signed distance field of ASCII %d..%d, %d field pixels per em. Glyph\n" % (FIRST, LAST, EM))
+    out.write("// cells: pen at x = FONT_PAD, baseline at y = FONT_PAD + FONT_ASCENT; each glyph\n")
+    out.write("// keeps the samples at x, y, w x h of its cell. Samples: 128 on the outline,\n")
+    out.write("// 127 / FONT_RANGE more (inside) or less (outside) per field pixel.\n")
+    out.write("#include <stdint.h>\n\n")
+    out.write("#define FONT_EM %d\n" % EM)
+    out.write("#define FONT_PAD %d\n" % PAD)
+    out.write("#define FONT_ASCENT %.4ff\n" % ascent)
+    out.write("#define FONT_DESCENT %.4ff\n" % descent)
+    out.write("#define FONT_ADVANCE %.4ff\n" % advance)
+    out.write("#define FONT_RANGE %.1ff\n" % RANGE)
+    out.write("#define FONT_FIRST %d\n" % FIRST)
+    out.write("#define FONT_LAST %d\n" % LAST)
+    out.write("#define FONT_FIELD_SIZE %d\n\n" % len(data))
+    out.write("struct font_glyph {\n    uint8_t x, y, w, h;\n    uint32_t offset;\n};\n\n")
+    out.write("static const struct font_glyph font_glyphs[%d] = {\n" % len(glyphs))
+    for i, g in enumerate(glyphs):
+        c = chr(FIRST + i)
+        name = "' '" if c == " " else ("'\\\\'" if c == "\\" else "'%s'" % c)
+        out.write("    {%d, %d, %d, %d, %d}, // %s\n" % (g + (name,)))
+    out.write("};\n\n")
+    out.write("// Base64\n")
+    out.write("static const char font_field_b64[] =\n")
+    for i in range(0, len(b64), 100):
+        out.write('    "%s"%s\n' % (b64[i:i + 100], ";" if i + 100 >= len(b64) else ""))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,161 @@
+// fps-analyzer-logconv: convert a binary per-frame event log (.falog) written
+// by the filter into CSV or JSON.
+#include "fps-analyzer-eventlog.h"
+#include <stdio.h>
+#include <string.h>
+
+static void print_usage(void)
+{
+    fprintf(stderr,
+            "Usage: fps-analyzer-logconv [options] <input.falog>\n"
+            "\n"
+            "  --format csv|json   output format (default csv)\n"
+            "  --output FILE       output file (default: stdout)\n"
+            "  --summary-only      only print the log summary to stderr\n");
+}
+
+struct row {
+    uint64_t index;   // position in the whole session, including overwritten records
+    double unix_time; // seconds, from the header's clock pair
+    double time_ms;   // since the first record still in the log
+    double frametime_ms;
+    double diff_percent;
+    bool tearing;
+    bool first;
+};
+
+static void make_row(const struct fa_event_log_view *view, uint64_t i, uint64_t first_ts, struct row *r)
+{
+    const struct fa_event_record *rec = &view->records[(view->first + i) % view->header->capacity];
+    const struct fa_event_log_header *h = view->header;
+    r->index = h->write_count - view->count + i;
+    r->unix_time = ((double)h->start_unix_ns + ((double)rec->timestamp_ns - (double)h->start_timestamp_ns)) / 1e9;
+    r->time_ms = (rec->timestamp_ns - first_ts) / 1e6;
+    r->frametime_ms = rec->frametime_us / 1000.0;
+    r->diff_percent = rec->diff_centi_pct / 100.0;
+    r->tearing = (rec->flags & FA_EVENT_TEARING) != 0;
+    r->first = (rec->flags & FA_EVENT_FIRST) != 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *input_path = NULL;
+    const char *output_path = NULL;
+    bool json = false;
+    bool summary_only = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        bool takes_value = true;
+        if (strcmp(arg, "--format") == 0 && val) {
+            if (strcmp(val, "json") == 0)
+                json = true;
+            else if (strcmp(val, "csv") == 0)
+                json = false;
+            else {
+                fprintf(stderr, "Invalid --format: %s\n", val);
+                return 2;
+            }
+        } else if (strcmp(arg, "--output") == 0 && val) {
+            output_path = val;
+        } else {
+            takes_value = false;
+            if (strcmp(arg, "--summary-only") == 0) {
+                summary_only = true;
+            } else if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+                print_usage();
+                return 0;
+            } else if (arg[0] != '-' && !input_path) {
+                input_path = arg;
+            } else {
+                fprintf(stderr, "Unknown or incomplete option: %s\n", arg);
+                print_usage();
+                return 2;
+            }
+        }
+        if (takes_value)
+            ++i;
+    }
+    if (!input_path) {
+        print_usage();
+        return 2;
+    }
+
+    struct fa_event_log_view view;
+    char error[256];
+    if (!fa_event_log_open_view(input_path, &view, error, sizeof(error))) {
+        fprintf(stderr, "%s\n", error);
+        return 1;
+    }
+
+    FILE *out = NULL;
+    if (!summary_only) {
+        out = output_path ? fopen(output_path, "w") : stdout;
+        if (!out) {
+            fprintf(stderr, "Cannot write %s\n", output_path);
+            fa_event_log_close_view(&view);
+            return 1;
+        }
+        setvbuf(out, NULL, _IOFBF, 1 << 20);
+    }
+
+    const uint64_t first_ts = view.count ? view.records[view.first].timestamp_ns : 0;
+    uint64_t tearing = 0;
+    double frametime_sum = 0.0;
+    uint64_t frametime_count = 0;
+
+    if (out && json)
+        fprintf(out, "{\n  \"capacity\": %llu,\n  \"total_frames\": %llu,\n  \"frames\": [",
+                (unsigned long long)view.header->capacity,
+                (unsigned long long)view.header->write_count);
+    else if (out)
+        fprintf(out, "frame,unix_time,time_ms,frametime_ms,diff_percent,tearing\n");
+
+    for (uint64_t i = 0; i < view.count; ++i) {
+        struct row r;
+        make_row(&view, i, first_ts, &r);
+        if (r.tearing)
+            tearing++;
+        if (!r.first) {
+            frametime_sum += r.frametime_ms;
+            frametime_count++;
+        }
+        if (!out)
+            continue;
+        if (json) {
+            fprintf(out, "%s\n    {\"frame\": %llu, \"unix_time\": %.6f, \"time_ms\": %.3f, ",
+                    i ? "," : "", (unsigned long long)r.index, r.unix_time, r.time_ms);
+            if (r.first)
+                fprintf(out, "\"frametime_ms\": null, ");
+            else
+                fprintf(out, "\"frametime_ms\": %.3f, ", r.frametime_ms);
+            fprintf(out, "\"diff_percent\": %.2f, \"tearing\": %s}", r.diff_percent,
+                    r.tearing ? "true" : "false");
+        } else {
+            fprintf(out, "%llu,%.6f,%.3f,", (unsigned long long)r.index, r.unix_time, r.time_ms);
+            if (!r.first)
+                fprintf(out, "%.3f", r.frametime_ms);
+            fprintf(out, ",%.2f,%d\n", r.diff_percent, r.tearing ? 1 : 0);
+        }
+    }
+    if (out && json)
+        fprintf(out, "%s]\n}\n", view.count ? "\n  " : "");
+
+    if (out && out != stdout)
+        fclose(out);
+    else if (out)
+        fflush(out);
+
+    double avg_ft = frametime_count ? frametime_sum / frametime_count : 0.0;
+    fprintf(stderr,
+            "%s: %llu frames in log (%llu recorded, capacity %llu)\n"
+            "average frametime: %.3f ms (%.2f fps), tearing frames: %llu\n",
+            input_path, (unsigned long long)view.count,
+            (unsigned long long)view.header->write_count,
+            (unsigned long long)view.header->capacity,
+            avg_ft, avg_ft > 0.0 ? 1000.0 / avg_ft : 0.0, (unsigned long long)tearing);
+
+    fa_event_log_close_view(&view);
+    return 0;
+}
@@ -0,0 +1,520 @@
+// fps-analyzer-replay: run the FPS Analyzer detection over a recorded capture
+// (Y4M or raw NV12/YUY2/BGRA) as fast as possible and write per-frame results.
+#include "fps-analyzer-core.h"
+#include "fps-analyzer-kernels.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#define strcasecmp _stricmp
+#else
+#include <fcntl.h>
+#include <strings.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// --- Memory-mapped input ---
+
+struct mapped_file {
+    const uint8_t *data;
+    size_t size;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif
+};
+
+static bool map_file(const char *path, struct mapped_file *mf)
+{
+    memset(mf, 0, sizeof(*mf));
+#ifdef _WIN32
+    mf->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                           FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (mf->file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(mf->file, &size) || size.QuadPart == 0) {
+        CloseHandle(mf->file);
+        return false;
+    }
+    mf->mapping = CreateFileMappingA(mf->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mf->mapping) {
+        CloseHandle(mf->file);
+        return false;
+    }
+    mf->data = (const uint8_t *)MapViewOfFile(mf->mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!mf->data) {
+        CloseHandle(mf->mapping);
+        CloseHandle(mf->file);
+        return false;
+    }
+    mf->size = (size_t)size.QuadPart;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED)
+        return false;
+    madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+    mf->data = (const uint8_t *)p;
+    mf->size = (size_t)st.st_size;
+#endif
+    return true;
+}
+
+static void unmap_file(struct mapped_file *mf)
+{
+    if (!mf->data)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(mf->data);
+    CloseHandle(mf->mapping);
+    CloseHandle(mf->file);
+#else
+    munmap((void *)mf->data, mf->size);
+#endif
+    mf->data = NULL;
+}
+
+// --- Input layout ---
+
+// Where the frames are in the file and which plane the analysis reads
+struct input_layout {
+    fa_pixel_format_t format;
+    uint32_t width;
+    uint32_t height;
+    uint32_t linesize;     // stride of the analyzed plane
+    size_t frame_size;     // bytes of one frame payload (all planes)
+    size_t first_frame;    // offset of the first frame (header skipped)
+    bool y4m;              // frames are preceded by a FRAME line
+    uint32_t fps_num;
+    uint32_t fps_den;
+};
+
+// Y4M: "YUV4MPEG2 W.. H.. F..:.. C..\n" then "FRAME[ params]\n" + planes per frame
+static bool parse_y4m_header(const struct mapped_file *mf, struct input_layout *in)
+{
+    const char *p = (const char *)mf->data;
+    const char *end = (const char *)memchr(p, '\n', mf->size < 1024 ? mf->size : 1024);
+    if (!end || strncmp(p, "YUV4MPEG2 ", 10) != 0)
+        return false;
+
+    char chroma[32] = "420jpeg";
+    for (const char *t = p + 9; t < end; ++t) {
+        if (*t != ' ')
+            continue;
+        const char *v = t + 2;
+        switch (t[1]) {
+        case 'W':
+            in->width = (uint32_t)strtoul(v, NULL, 10);
+            break;
+        case 'H':
+            in->height = (uint32_t)strtoul(v, NULL, 10);
+            break;
+        case 'F': {
+            char *colon;
+            unsigned long num = strtoul(v, &colon, 10);
+            unsigned long den = (*colon == ':') ? strtoul(colon + 1, NULL, 10) : 1;
+            if (num > 0 && den > 0) {
+                in->fps_num = (uint32_t)num;
+                in->fps_den = (uint32_t)den;
+            }
+            break;
+        }
+        case 'C': {
+            size_t n = 0;
+            while (v + n < end && v[n] != ' ' && n < sizeof(chroma) - 1)
+                n++;
+            memcpy(chroma, v, n);
+            chroma[n] = '\0';
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    if (in->width == 0 || in->height == 0)
+        return false;
+
+    const size_t luma = (size_t)in->width * in->height;
+    const size_t cw = (in->width + 1) / 2, ch = (in->height + 1) / 2;
+    if (strncmp(chroma, "420", 3) == 0 && (chroma[3] == '\0' || strchr("jpm", chroma[3])))
+        in->frame_size = luma + 2 * cw * ch;
+    else if (strcmp(chroma, "422") == 0)
+        in->frame_size = luma + 2 * cw * in->height;
+    else if (strcmp(chroma, "444") == 0)
+        in->frame_size = luma * 3;
+    else if (strcmp(chroma, "mono") == 0)
+        in->frame_size = luma;
+    else {
+        fprintf(stderr, "Unsupported Y4M colorspace: C%s (8-bit 420/422/444/mono only)\n", chroma);
+        return false;
+    }
+    in->format = FA_FORMAT_Y8;
+    in->linesize = in->width;
+    in->first_frame = (size_t)(end + 1 - p);
+    in->y4m = true;
+    return true;
+}
+
+static bool setup_raw_layout(const char *format, struct input_layout *in)
+{
+    const size_t w = in->width, h = in->height;
+    if (strcasecmp(format, "nv12") == 0) {
+        in->format = FA_FORMAT_Y8;
+        in->linesize = in->width;
+        in->frame_size = w * h + 2 * ((w + 1) / 2) * ((h + 1) / 2);
+    } else if (strcasecmp(format, "yuy2") == 0) {
+        in->format = FA_FORMAT_YUY2;
+        in->linesize = (uint32_t)(((w + 1) / 2) * 4);
+        in->frame_size = (size_t)in->linesize * h;
+    } else if (strcasecmp(format, "bgra") == 0) {
+        in->format = FA_FORMAT_BGRA;
+        in->linesize = in->width * 4;
+        in->frame_size = (size_t)in->linesize * h;
+    } else {
+        fprintf(stderr, "Unknown raw format: %s (nv12, yuy2, bgra)\n", format);
+        return false;
+    }
+    in->first_frame = 0;
+    in->y4m = false;
+    return true;
+}
+
+// Next frame payload at *offset, NULL at the end of the file
+static const uint8_t *next_frame(const struct mapped_file *mf, const struct input_layout *in, size_t *offset)
+{
+    size_t pos = *offset;
+    if (in->y4m) {
+        if (pos + 5 > mf->size || memcmp(mf->data + pos, "FRAME", 5) != 0)
+            return NULL;
+        const uint8_t *nl = (const uint8_t *)memchr(mf->data + pos, '\n', mf->size - pos);
+        if (!nl)
+            return NULL;
+        pos = (size_t)(nl + 1 - mf->data);
+    }
+    if (pos + in->frame_size > mf->size)
+        return NULL;
+    *offset = pos + in->frame_size;
+    return mf->data + pos;
+}
+
+// --- Command line ---
+
+static void print_usage(void)
+{
+    fprintf(stderr,
+            "Usage: fps-analyzer-replay [options] <input>\n"
+            "\n"
+            "Input: Y4M (detected from the header) or raw frames with --format and --size.\n"
+            "\n"
+            "  --format nv12|yuy2|bgra   raw input pixel format\n"
+            "  --size WxH                raw input frame size\n"
+            "  --fps N[:D]               capture rate (default 60, or the Y4M header)\n"
+            "  --method M                lastline, full, tiled or sampled (default lastline)\n"
+            "  --sample-rows K           rows compared by --method sampled (default 32)\n"
+            "  --sample-jitter           jittered instead of evenly spaced sampled rows\n"
+            "  --sample-step N           compare every N-th pixel of a sampled row (default 1)\n"
+            "  --threads N               threads for --method full at 1080p and up (default 1)\n"
+            "  --sensitivity P           %% of the analyzed pixels that must change (default 0.1)\n"
+            "  --tearing-sensitivity P   %% of a line that must change (default 1.0)\n"
+            "  --no-tearing              disable tearing detection\n"
+            "  --output FILE             per-frame CSV (default: stdout)\n"
+            "  --tile-map FILE           --method tiled: CSV grid of the frames each tile changed in\n"
+            "  --summary-only            no per-frame output\n"
+            "  --simd LEVEL              force scalar|sse2|avx2|avx512|neon kernels\n");
+}
+
+static bool parse_simd_level(const char *name, fa_simd_level_t *level)
+{
+    static const char *names[] = {"scalar", "sse2", "avx2", "avx512", "neon"};
+    for (int l = FA_SIMD_SCALAR; l <= FA_SIMD_NEON; ++l) {
+        if (strcasecmp(name, names[l]) == 0) {
+            *level = (fa_simd_level_t)l;
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char **argv)
+{
+    const char *input_path = NULL;
+    const char *raw_format = NULL;
+    const char *output_path = NULL;
+    const char *tile_map_path = NULL;
+    const char *simd = NULL;
+    bool summary_only = false;
+    struct input_layout in;
+    memset(&in, 0, sizeof(in));
+    uint32_t fps_num = 0, fps_den = 1;
+
+    struct fa_detector det;
+    memset(&det, 0, sizeof(det));
+    det.analyze_method = ANALYZE_LAST_LINE;
+    det.sensitivity = 0.1;
+    det.enable_tearing_detection = true;
+    det.tearing_sensitivity = 1.0;
+    det.sample_rows = 32;
+    det.sample_column_step = 1;
+    det.analysis_threads = 1;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        bool takes_value = true;
+        if (strcmp(arg, "--format") == 0 && val) {
+            raw_format = val;
+        } else if (strcmp(arg, "--size") == 0 && val) {
+            if (sscanf(val, "%ux%u", &in.width, &in.height) != 2) {
+                fprintf(stderr, "Invalid --size: %s\n", val);
+                return 2;
+            }
+        } else if (strcmp(arg, "--fps") == 0 && val) {
+            char *colon;
+            fps_num = (uint32_t)strtoul(val, &colon, 10);
+            fps_den = (*colon == ':') ? (uint32_t)strtoul(colon + 1, NULL, 10) : 1;
+            if (fps_num == 0 || fps_den == 0) {
+                fprintf(stderr, "Invalid --fps: %s\n", val);
+                return 2;
+            }
+        } else if (strcmp(arg, "--method") == 0 && val) {
+            if (strcmp(val, "full") == 0)
+                det.analyze_method = ANALYZE_DIFF;
+            else if (strcmp(val, "tiled") == 0)
+                det.analyze_method = ANALYZE_TILED;
+            else if (strcmp(val, "sampled") == 0)
+                det.analyze_method = ANALYZE_SAMPLED;
+            else if (strcmp(val, "lastline") == 0)
+                det.analyze_method = ANALYZE_LAST_LINE;
+            else {
+                fprintf(stderr, "Invalid --method: %s\n", val);
+                return 2;
+            }
+        } else if (strcmp(arg, "--sample-rows") == 0 && val) {
+            det.sample_rows = (uint32_t)strtoul(val, NULL, 10);
+        } else if (strcmp(arg, "--sample-step") == 0 && val) {
+            det.sample_column_step = (uint32_t)strtoul(val, NULL, 10);
+            if (det.sample_column_step == 0) {
+                fprintf(stderr, "Invalid --sample-step: %s\n", val);
+                return 2;
+            }
+        } else if (strcmp(arg, "--threads") == 0 && val) {
+            det.analysis_threads = (uint32_t)strtoul(val, NULL, 10);
+            if (det.analysis_threads < 1 || det.analysis_threads > FA_MT_MAX_THREADS) {
+                fprintf(stderr, "Invalid --threads: %s\n", val);
+                return 2;
+            }
+        } else if (strcmp(arg, "--sensitivity") == 0 && val) {
+            det.sensitivity = atof(val);
+        } else if (strcmp(arg, "--tearing-sensitivity") == 0 && val) {
+            det.tearing_sensitivity = atof(val);
+        } else if (strcmp(arg, "--output") == 0 && val) {
+            output_path = val;
+        } else if (strcmp(arg, "--tile-map") == 0 && val) {
+            tile_map_path = val;
+        } else if (strcmp(arg, "--simd") == 0 && val) {
+            simd = val;
+        } else {
+            takes_value = false;
+            if (strcmp(arg, "--no-tearing") == 0) {
+                det.enable_tearing_detection = false;
+            } else if (strcmp(arg, "--sample-jitter") == 0) {
+                det.sample_jitter = true;
+            } else if (strcmp(arg, "--summary-only") == 0) {
+                summary_only = true;
+            } else if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+                print_usage();
+                return 0;
+            } else if (arg[0] != '-' && !input_path) {
+                input_path = arg;
+            } else {
+                fprintf(stderr, "Unknown or incomplete option: %s\n", arg);
+                print_usage();
+                return 2;
+            }
+        }
+        if (takes_value)
+            ++i;
+    }
+    if (!input_path) {
+        print_usage();
+        return 2;
+    }
+
+    fa_kernels_init();
+    if (simd) {
+        fa_simd_level_t level;
+        if (!parse_simd_level(simd, &level) || !fa_kernels_select(level)) {
+            fprintf(stderr, "SIMD level not available: %s\n", simd);
+            return 2;
+        }
+    }
+
+    struct mapped_file mf;
+    if (!map_file(input_path, &mf)) {
+        fprintf(stderr, "Cannot open %s\n", input_path);
+        return 1;
+    }
+
+    bool layout_ok;
+    if (mf.size >= 10 && memcmp(mf.data, "YUV4MPEG2 ", 10) == 0) {
+        layout_ok = parse_y4m_header(&mf, &in);
+    } else if (!raw_format || in.width == 0 || in.height == 0) {
+        fprintf(stderr, "Raw input needs --format and --size\n");
+        layout_ok = false;
+    } else {
+        layout_ok = setup_raw_layout(raw_format, &in);
+    }
+    if (!layout_ok) {
+        unmap_file(&mf);
+        return 1;
+    }
+    if (fps_num) {
+        in.fps_num = fps_num;
+        in.fps_den = fps_den;
+    } else if (!in.fps_num) {
+        in.fps_num = 60;
+        in.fps_den = 1;
+    }
+
+    FILE *out = NULL;
+    if (!summary_only) {
+        out = output_path ? fopen(output_path, "w") : stdout;
+        if (!out) {
+            fprintf(stderr, "Cannot write %s\n", output_path);
+            unmap_file(&mf);
+            return 1;
+        }
+        setvbuf(out, NULL, _IOFBF, 1 << 20);
+        fprintf(out, "frame,time_ms,unique,diff_percent,tearing,frametime_ms,fps\n");
+    }
+
+    struct fa_stats *stats = (struct fa_stats *)calloc(1, sizeof(struct fa_stats));
+
+    // Frames get capture timestamps at the nominal rate, starting at 1 s
+    // (a zero timestamp means "no previous frame" to the stats)
+    const double frame_ns = 1e9 * in.fps_den / in.fps_num;
+    const uint64_t base_ns = 1000000000ULL;
+
+    uint64_t frames = 0, unique = 0, tearing = 0;
+    uint64_t tiles_total = 0, tiles_scanned = 0, bytes_scanned = 0;
+    uint64_t first_unique_ns = 0, last_unique_ns = 0;
+    // Frames in which each tile was compared and found changed
+    uint32_t *tile_changes = NULL;
+    uint32_t tile_cols = 0, tile_rows = 0;
+    size_t offset = in.first_frame;
+    const uint8_t *frame;
+
+    auto start = std::chrono::steady_clock::now();
+    while ((frame = next_frame(&mf, &in, &offset)) != NULL) {
+        uint64_t ts = base_ns + (uint64_t)(frames * frame_ns + 0.5);
+        struct fa_frame_result result;
+        fa_detector_process(&det, in.format, frame, in.linesize, in.width, in.height, &result);
+        bool added = fa_stats_push(stats, &result, ts);
+
+        if (result.unique) {
+            if (!first_unique_ns)
+                first_unique_ns = ts;
+            last_unique_ns = ts;
+            unique++;
+        }
+        if (result.tearing)
+            tearing++;
+        tiles_total += result.tiles_total;
+        tiles_scanned += result.tiles_scanned;
+        bytes_scanned += result.bytes_scanned;
+        if (tile_map_path && result.tiles_total) {
+            uint32_t cols, rows;
+            const uint8_t *map = fa_detector_tile_map(&det, &cols, &rows);
+            if (!tile_changes) {
+                tile_changes = (uint32_t *)calloc((size_t)cols * rows, sizeof(uint32_t));
+                tile_cols = cols;
+                tile_rows = rows;
+            }
+            for (size_t t = 0; tile_changes && t < (size_t)cols * rows; ++t)
+                tile_changes[t] += map[t] == FA_TILE_CHANGED;
+        }
+
+        if (out) {
+            fprintf(out, "%llu,%.3f,%d,%.3f,%d,", (unsigned long long)frames,
+                    (ts - base_ns) / 1000000.0, result.unique ? 1 : 0,
+                    result.diff_percent, result.tearing ? 1 : 0);
+            if (added)
+                fprintf(out, "%.3f,%u\n", stats->frametime_us[fa_stats_newest(stats)] / 1000.0,
+                        (unsigned)stats->fps[fa_stats_newest(stats)]);
+            else
+                fprintf(out, ",\n");
+        }
+        frames++;
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (out && out != stdout)
+        fclose(out);
+    else if (out)
+        fflush(out);
+
+    double avg_fps = (unique > 1 && last_unique_ns > first_unique_ns)
+        ? (unique - 1) * 1e9 / (double)(last_unique_ns - first_unique_ns) : 0.0;
+    fprintf(stderr,
+            "%s: %ux%u, %llu frames at %.3f fps\n"
+            "unique frames: %llu (average %.2f fps), tearing frames: %llu\n"
+            "analysis: %.3f s, %.1f frames/s, %.1f MB/s (kernels: %s)\n",
+            input_path, in.width, in.height, (unsigned long long)frames,
+            (double)in.fps_num / in.fps_den,
+            (unsigned long long)unique, avg_fps, (unsigned long long)tearing,
+            elapsed, elapsed > 0.0 ? frames / elapsed : 0.0,
+            elapsed > 0.0 ? frames * (double)in.frame_size / elapsed / 1e6 : 0.0,
+            fa_simd_level_name(fa_kernels_level()));
+    struct fa_frametime_stats ft;
+    fa_ft_histogram_summary(&stats->session, &ft);
+    if (ft.frames)
+        fprintf(stderr, "frametime: avg %.2f ms, p50 %.2f, p99 %.2f, p99.9 %.2f; 1%% low %.1f fps, 0.1%% low %.1f fps\n",
+                ft.avg_ms, ft.p50_ms, ft.p99_ms, ft.p999_ms, ft.low_1_fps, ft.low_01_fps);
+    struct fa_pacing_stats pacing;
+    fa_pacing_summary(&stats->pacing, &pacing);
+    if (pacing.cadence_refreshes > 0)
+        fprintf(stderr, "pacing: %.1f fps cadence at %.2f Hz, %.1f%% of recent frames even, "
+                "%llu off cadence, %llu stutters\n",
+                pacing.cadence_fps, pacing.refresh_hz, pacing.consistency,
+                (unsigned long long)pacing.violations, (unsigned long long)pacing.stutters);
+    if (frames)
+        fprintf(stderr, "compared: %.0f luma bytes/frame (%.2f%% of the frame)\n",
+                (double)bytes_scanned / frames, 100.0 * bytes_scanned / frames / ((double)in.width * in.height));
+    if (det.analyze_method == ANALYZE_TILED && tiles_total)
+        fprintf(stderr, "tiles compared: %.1f%% (early exit)\n", 100.0 * tiles_scanned / tiles_total);
+    if (tile_map_path) {
+        FILE *tf = fopen(tile_map_path, "w");
+        if (!tf) {
+            fprintf(stderr, "Cannot write %s\n", tile_map_path);
+        } else {
+            // One line per band of FA_TILE_HEIGHT rows, one column per FA_TILE_WIDTH bytes
+            for (uint32_t r = 0; r < tile_rows; ++r) {
+                for (uint32_t c = 0; c < tile_cols; ++c)
+                    fprintf(tf, c ? ",%u" : "%u", tile_changes[(size_t)r * tile_cols + c]);
+                fputc('\n', tf);
+            }
+            fclose(tf);
+        }
+    }
+    free(tile_changes);
+
+    fa_stats_free(stats);
+    free(stats);
+    fa_detector_free(&det);
+    unmap_file(&mf);
+    return 0;
+}